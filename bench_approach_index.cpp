@@ -0,0 +1,94 @@
+// bench_approach_index.cpp
+//
+// "Every close approach in a 30-day window under 0.05 au", answered by:
+//   json rescan   walking the feed's json and parsing each approach's
+//                 epoch and miss distance again
+//   field scan    a linear pass over already extracted NeoFields
+//   index         CloseApproachIndex::query
+// The archive is data.json repeated `copies` times, each copy shifted one
+// week later, so the approaches spread over copies / 52 years.
+//
+// Usage: ./bench_approach_index [copies] [queries]
+
+#include "bench_common.h"
+#include "src/approach_index.h"
+#include "src/body_physics.h"
+#include "src/feed_hydration.h"
+#include "src/neo_dates.h"
+#include "src/neo_numbers.h"
+#include <random>
+
+using namespace std;
+
+template <typename Query>
+static void measure(const char* label, const vector<int64_t>& starts, Query query) {
+    size_t found = 0;
+    auto begin = chrono::steady_clock::now();
+    for (int64_t from : starts) found += query(from, from + 30 * NeoDates::msPerDay);
+    double seconds = bench::secondsSince(begin);
+    printf("%-12s %10.2f us/query   %zu approaches found\n", label, seconds * 1e6 / starts.size(), found);
+}
+
+int main(int argc, char** argv) {
+    int copies = argc > 1 ? atoi(argv[1]) : 200;
+    int queries = argc > 2 ? atoi(argv[2]) : 200;
+    const int64_t week = 7 * NeoDates::msPerDay;
+    const double maxAu = 0.05;
+
+    json source;
+    if (!load_from_file(source, "data.json")) return 1;
+    json archive = json::array(); // One entry per NEO, across all copies
+    for (int copy = 0; copy < copies; copy++) {
+        for (const auto& date : source["near_earth_objects"].items()) {
+            for (json neo : date.value()) {
+                for (auto& approach : neo["close_approach_data"]) {
+                    approach["epoch_date_close_approach"] = approach["epoch_date_close_approach"].get<int64_t>() + copy * week;
+                }
+                archive.push_back(std::move(neo));
+            }
+        }
+    }
+    vector<NeoFields> rows(archive.size());
+    for (size_t i = 0; i < archive.size(); i++) extract_neo_fields(archive[i], rows[i]);
+
+    auto start = chrono::steady_clock::now();
+    CloseApproachIndex index;
+    index.build(rows);
+    printf("%zu approaches, index built in %.1f ms\n", index.size(), bench::secondsSince(start) * 1e3);
+
+    int64_t first = rows.front().closeApproaches[0].epochMs;
+    mt19937_64 random(7);
+    uniform_int_distribution<int64_t> offset(0, copies * week);
+    vector<int64_t> starts(queries);
+    for (auto& from : starts) from = first + offset(random);
+
+    measure("json rescan", starts, [&](int64_t from, int64_t to) {
+        size_t count = 0;
+        for (const auto& neo : archive) {
+            for (const auto& approach : neo["close_approach_data"]) {
+                int64_t epochMs = approach["epoch_date_close_approach"].get<int64_t>();
+                double km = 0;
+                decode_number(approach["miss_distance"]["kilometers"].get_ref<const string&>(), km);
+                count += epochMs >= from && epochMs < to && km / BodyPhysics::kmPerAu < maxAu;
+            }
+        }
+        return count;
+    });
+    measure("field scan", starts, [&](int64_t from, int64_t to) {
+        size_t count = 0;
+        for (const auto& row : rows) {
+            for (const auto& approach : row.closeApproaches) {
+                count += approach.epochMs >= from && approach.epochMs < to &&
+                         approach.miss_distance / BodyPhysics::kmPerAu < maxAu;
+            }
+        }
+        return count;
+    });
+    vector<ApproachHit> hits;
+    measure("index", starts, [&](int64_t from, int64_t to) {
+        hits.clear();
+        index.query(from, to, maxAu, hits);
+        return hits.size();
+    });
+    return 0;
+}
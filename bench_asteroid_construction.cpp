@@ -0,0 +1,78 @@
+// bench_asteroid_construction.cpp
+//
+// Construction rate of Asteroids from NeoWs objects already in memory.
+// "lookup chain" repeats the field access of the previous constructor:
+// chained .at() lookups, the diameter subtree read three times and copies
+// of the diameter and close approach subtrees. "field table" is
+// extract_neo_fields alone, and "Asteroid(json)" the full constructor
+// built on it.
+//
+// Usage: ./bench_asteroid_construction [passes over data.json]
+
+#include "bench_common.h"
+#include "src/classes.h"
+#include <vector>
+
+using namespace std;
+
+// The lookups the previous Asteroid(const json&) made
+static double lookupChain(const json& neo, NeoFields& fields) {
+    fields.name = neo.at("name").get<string>();
+    fields.minDiameterKm = neo.at("estimated_diameter").at("kilometers").at("estimated_diameter_min").get<double>();
+    double mass = neo.at("estimated_diameter").at("kilometers").at("estimated_diameter_max").get<double>();
+    fields.id = neo.at("id").get<string>();
+    fields.nasaJplUrl = neo.at("nasa_jpl_url").get<string>();
+    fields.absoluteMagnitude = neo.at("absolute_magnitude_h").get<double>();
+    fields.potentiallyHazardous = neo.at("is_potentially_hazardous_asteroid").get<bool>();
+
+    auto diameter = neo.at("estimated_diameter").at("kilometers");
+    fields.minDiameterKm = diameter.at("estimated_diameter_min").get<double>();
+    fields.maxDiameterKm = diameter.at("estimated_diameter_max").get<double>();
+
+    fields.closeApproaches.clear();
+    auto close_approaches = neo.at("close_approach_data");
+    for (const auto& approach : close_approaches) {
+        CloseApproachData data;
+        data.date = approach.at("close_approach_date").get<string>();
+        data.relative_velocity = stod(approach.at("relative_velocity").at("kilometers_per_second").get<string>());
+        data.miss_distance = stod(approach.at("miss_distance").at("kilometers").get<string>());
+        fields.closeApproaches.push_back(data);
+    }
+    mass += neo.at("estimated_diameter").at("kilometers").at("estimated_diameter_min").get<double>();
+    return mass;
+}
+
+template <typename Build>
+static void measure(const char* label, const vector<const json*>& neos, int passes, Build build) {
+    auto start = chrono::steady_clock::now();
+    double checksum = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        for (const json* neo : neos) checksum += build(*neo);
+    }
+    double seconds = bench::secondsSince(start);
+    double count = static_cast<double>(neos.size()) * passes;
+    printf("%-16s %10.0f constructions/s   %7.1f ns each   (checksum %g)\n", label, count / seconds,
+           seconds / count * 1e9, checksum);
+}
+
+int main(int argc, char** argv) {
+    int passes = argc > 1 ? atoi(argv[1]) : 200;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    vector<const json*> neos;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) neos.push_back(&neo);
+    }
+    printf("%zu NEOs x %d passes\n", neos.size(), passes);
+
+    NeoFields fields;
+    measure("lookup chain", neos, passes, [&](const json& neo) { return lookupChain(neo, fields); });
+    measure("field table", neos, passes, [&](const json& neo) {
+        extract_neo_fields(neo, fields);
+        return fields.maxDiameterKm;
+    });
+
+    measure("Asteroid(json)", neos, passes, [](const json& neo) { return Asteroid(neo).getMass(); });
+    return 0;
+}
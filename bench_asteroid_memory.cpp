@@ -0,0 +1,145 @@
+// bench_asteroid_memory.cpp
+//
+// Heap allocations and bytes per asteroid for an archive of N asteroids,
+// built from the NEOs of data.json with unique ids and names:
+//   Asteroid objects   vector<Asteroid>, one std::string per id/name/URL
+//   string columns     AsteroidTable's previous layout, with vector<string>
+//                      columns for ids, names, URLs and approach dates
+//   AsteroidTable      numeric ids, arena names, interned dates, URLs
+//                      rebuilt from the id
+// Allocations are counted by replacing the global operator new.
+//
+// Usage: ./bench_asteroid_memory [asteroids]
+
+#include "bench_common.h"
+#include "src/asteroid_table.h"
+#include "src/body_physics.h"
+#include "src/feed_hydration.h"
+#include <atomic>
+#include <new>
+
+using namespace std;
+
+static atomic<size_t> allocations(0);
+static atomic<size_t> liveBytes(0);
+static bool counting = false; // Off while the next archive row is generated
+
+// Each block carries its size in a header, so delete can keep liveBytes exact
+void* operator new(size_t size) {
+    void* block = malloc(size + 16);
+    if (!block) throw bad_alloc();
+    *static_cast<size_t*>(block) = size;
+    if (counting) allocations++;
+    liveBytes += size;
+    return static_cast<char*>(block) + 16;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    void* block = static_cast<char*>(pointer) - 16;
+    liveBytes -= *static_cast<size_t*>(block);
+    free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+// The columns AsteroidTable had before strings moved into an arena
+struct StringColumns {
+    vector<string> ids, names, urls;
+    vector<double> masses, minDiameters, maxDiameters, magnitudes;
+    vector<uint64_t> hazardBits;
+    vector<uint32_t> approachBegin{0};
+    vector<string> approachDates;
+    vector<double> velocities, missDistances;
+
+    void append(const NeoFields& row) {
+        size_t index = masses.size();
+        ids.push_back(row.id);
+        names.push_back(row.name);
+        urls.push_back(row.nasaJplUrl);
+        masses.push_back(BodyPhysics::asteroidMass(row.minDiameterKm, row.maxDiameterKm));
+        minDiameters.push_back(row.minDiameterKm);
+        maxDiameters.push_back(row.maxDiameterKm);
+        magnitudes.push_back(row.absoluteMagnitude);
+        if (index % 64 == 0) hazardBits.push_back(0);
+        if (row.potentiallyHazardous) hazardBits.back() |= uint64_t(1) << (index % 64);
+        for (const auto& approach : row.closeApproaches) {
+            approachDates.push_back(approach.date.str());
+            velocities.push_back(approach.relative_velocity);
+            missDistances.push_back(approach.miss_distance);
+        }
+        approachBegin.push_back(static_cast<uint32_t>(velocities.size()));
+    }
+};
+
+// Row i of the archive: a NEO of data.json under a unique id and name
+static void archiveRow(const FeedFields& source, size_t i, NeoFields& row) {
+    counting = false;
+    const NeoFields& base = source.rows[i % source.rows.size()];
+    row = base;
+    row.id = to_string(3000000 + i);
+    row.name = base.name + " #" + to_string(i / source.rows.size());
+    row.nasaJplUrl = AsteroidTable::jplUrlPrefix + row.id;
+    counting = true;
+}
+
+template <typename Build>
+static void measure(const char* label, size_t count, Build build) {
+    size_t allocationsBefore = allocations;
+    size_t bytesBefore = liveBytes;
+    counting = true;
+    auto start = chrono::steady_clock::now();
+    build();
+    double seconds = bench::secondsSince(start);
+    counting = false;
+    size_t made = allocations - allocationsBefore;
+    size_t bytes = liveBytes - bytesBefore;
+    printf("%-18s %7.1f bytes/asteroid   %6.2f allocations/asteroid   %7.1f ms\n", label,
+           static_cast<double>(bytes) / count, static_cast<double>(made) / count, seconds * 1e3);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    FeedFields source;
+    extract_feed_fields(feed, source, 1);
+    feed = json();
+    printf("%zu asteroids\n", count);
+
+    // Rows are generated into one reused NeoFields and their allocations are not
+    // counted, so only the containers' own show up; each is measured while alive
+    NeoFields row;
+    {
+        vector<Asteroid> objects;
+        measure("Asteroid objects", count, [&] {
+            objects.reserve(count);
+            for (size_t i = 0; i < count; i++) {
+                archiveRow(source, i, row);
+                objects.emplace_back(row);
+            }
+        });
+    }
+    {
+        StringColumns columns;
+        measure("string columns", count, [&] {
+            for (size_t i = 0; i < count; i++) {
+                archiveRow(source, i, row);
+                columns.append(row);
+            }
+        });
+    }
+    {
+        AsteroidTable table;
+        measure("AsteroidTable", count, [&] {
+            for (size_t i = 0; i < count; i++) {
+                archiveRow(source, i, row);
+                table.append(row);
+            }
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+// bench_asteroid_table.cpp
+//
+// Bulk scans over a vector<Asteroid> (one object per row, strings, a heap
+// vector and a vtable pointer each) versus the columns of an AsteroidTable.
+//
+// Usage: ./bench_asteroid_table [scale] [passes]
+//   scale: how many times data.json is repeated in the feed
+
+#include "bench_common.h"
+#include "src/asteroid_table.h"
+#include "src/feed_hydration.h"
+
+using namespace std;
+
+template <typename Scan>
+static void measure(const char* label, size_t rows, int passes, Scan scan) {
+    auto start = chrono::steady_clock::now();
+    double checksum = 0;
+    for (int pass = 0; pass < passes; pass++) checksum += scan();
+    double seconds = bench::secondsSince(start);
+    printf("%-26s %8.2f ns/row   (checksum %g)\n", label, seconds / passes / rows * 1e9, checksum);
+}
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? atoi(argv[1]) : 200;
+    int passes = argc > 2 ? atoi(argv[2]) : 50;
+
+    json feed;
+    if (!load_from_file(feed, bench::writeScaledFeed("data.json", scale))) return 1;
+    AsteroidFeed objects;
+    hydrate_feed(feed, objects);
+    AsteroidTable table;
+    table.loadFeed(feed);
+    feed = json();
+
+    size_t rows = table.size();
+    printf("%zu rows, sizeof(Asteroid) = %zu bytes\n", rows, sizeof(Asteroid));
+
+    measure("total mass, objects", rows, passes, [&] {
+        double total = 0;
+        for (const auto& asteroid : objects.asteroids) total += asteroid.getMass();
+        return total;
+    });
+    measure("total mass, columns", rows, passes, [&] { return table.totalMass(); });
+
+    measure("impact energy, objects", rows, passes, [&] {
+        double total = 0;
+        for (const auto& asteroid : objects.asteroids) total += asteroid.calculateImpactEnergy();
+        return total;
+    });
+    vector<double> energies;
+    measure("impact energy, columns", rows, passes, [&] {
+        table.impactEnergies(energies);
+        double total = 0;
+        for (double energy : energies) total += energy;
+        return total;
+    });
+
+    measure("hazard count, objects", rows, passes, [&] {
+        size_t count = 0;
+        for (const auto& asteroid : objects.asteroids) count += asteroid.isDangerous();
+        return static_cast<double>(count);
+    });
+    measure("hazard count, bitmap", rows, passes, [&] { return static_cast<double>(table.countHazardous()); });
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+// bench_body_kernels.cpp
+//
+// Bodies per second of each BodyKernels batch kernel at every level this
+// CPU runs (scalar, AVX2, AVX-512), over synthetic catalogue columns.
+// "screen" runs all four kernels back to back, as a catalogue update does.
+//
+// Usage: ./bench_body_kernels [bodies] [passes]
+
+#include "bench_common.h"
+#include "src/body_kernels.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+template <typename Kernel>
+static void measure(const char* label, size_t bodies, int passes, Kernel kernel) {
+    kernel(); // Warm up caches and the page tables of the output
+    auto start = chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; pass++) kernel();
+    double seconds = bench::secondsSince(start);
+    printf("  %-18s %10.1f M bodies/s\n", label, bodies * double(passes) / seconds / 1e6);
+}
+
+int main(int argc, char** argv) {
+    size_t bodies = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+    int passes = argc > 2 ? atoi(argv[2]) : 20;
+
+    mt19937_64 random(42);
+    uniform_real_distribution<double> exponent(-3.0, 2.5);
+    uniform_real_distribution<double> spread(1.0, 2.5);
+    uniform_real_distribution<double> speed(1.0, 70.0);
+    vector<double> minDiameter(bodies), maxDiameter(bodies), velocity(bodies);
+    for (size_t i = 0; i < bodies; i++) {
+        minDiameter[i] = pow(10.0, exponent(random));
+        maxDiameter[i] = minDiameter[i] * spread(random);
+        velocity[i] = speed(random);
+    }
+    vector<double> mass(bodies), gravity(bodies), escape(bodies), energy(bodies);
+    printf("%zu bodies, %d passes\n", bodies, passes);
+
+    for (BodyKernels::Level level :
+         {BodyKernels::Level::Scalar, BodyKernels::Level::Avx2, BodyKernels::Level::Avx512}) {
+        if (!BodyKernels::setLevel(level)) {
+            printf("%s: not supported by this CPU\n", BodyKernels::levelName(level));
+            continue;
+        }
+        printf("%s\n", BodyKernels::levelName(level));
+        measure("mass", bodies, passes, [&] {
+            BodyKernels::asteroidMasses(minDiameter.data(), maxDiameter.data(), mass.data(), bodies);
+        });
+        measure("surface gravity", bodies, passes, [&] {
+            BodyKernels::surfaceGravities(minDiameter.data(), mass.data(), gravity.data(), bodies);
+        });
+        measure("escape velocity", bodies, passes, [&] {
+            BodyKernels::escapeVelocities(minDiameter.data(), mass.data(), escape.data(), bodies);
+        });
+        measure("impact energy", bodies, passes, [&] {
+            BodyKernels::impactEnergies(mass.data(), velocity.data(), energy.data(), bodies);
+        });
+        measure("screen (all four)", bodies, passes, [&] {
+            BodyKernels::asteroidMasses(minDiameter.data(), maxDiameter.data(), mass.data(), bodies);
+            BodyKernels::surfaceGravities(minDiameter.data(), mass.data(), gravity.data(), bodies);
+            BodyKernels::escapeVelocities(minDiameter.data(), mass.data(), escape.data(), bodies);
+            BodyKernels::impactEnergies(mass.data(), velocity.data(), energy.data(), bodies);
+        });
+    }
+    return 0;
+}
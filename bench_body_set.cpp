@@ -0,0 +1,99 @@
+// bench_body_set.cpp
+//
+// Batch surface gravity / escape velocity and an asteroid-only impact
+// energy pass over a mixed collection of planets and asteroids (one planet
+// per ten asteroids), held as:
+//   unique_ptr           vector<unique_ptr<SpaceBody>>, dynamic_cast for
+//                        the asteroid-only pass
+//   unique_ptr shuffled  the same pointers visited out of allocation order,
+//                        as after a collection has been edited for a while
+//   BodySet              contiguous variant<Planet, Asteroid>
+//
+// Usage: ./bench_body_set [bodies] [passes]
+
+#include "bench_common.h"
+#include "src/body_set.h"
+#include "src/feed_hydration.h"
+#include "src/planets.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+
+using namespace std;
+
+template <typename Pass>
+static void measure(const char* label, size_t count, int passes, Pass pass) {
+    double best = 1e30;
+    volatile double sink = 0;
+    for (int i = 0; i < passes; i++) {
+        auto start = chrono::steady_clock::now();
+        sink = sink + pass();
+        best = min(best, bench::secondsSince(start));
+    }
+    printf("%-34s %7.2f ns/body\n", label, best * 1e9 / count);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 200000;
+    int passes = argc > 2 ? atoi(argv[2]) : 20;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    FeedFields source;
+    extract_feed_fields(feed, source, 1);
+
+    vector<unique_ptr<SpaceBody>> pointers;
+    BodySet set;
+    pointers.reserve(count);
+    set.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (i % 11 == 0) {
+            const PlanetData& planet = SolarSystem::predefinedPlanets[(i / 11) % SolarSystem::predefinedPlanets.size()];
+            pointers.emplace_back(new Planet(planet.name, planet.diameter, planet.mass));
+            set.add(Planet(planet.name, planet.diameter, planet.mass));
+        } else {
+            const NeoFields& fields = source.rows[i % source.rows.size()];
+            pointers.emplace_back(new Asteroid(fields));
+            set.add(Asteroid(fields));
+        }
+    }
+    vector<SpaceBody*> shuffled;
+    for (const auto& body : pointers) shuffled.push_back(body.get());
+    shuffle(shuffled.begin(), shuffled.end(), mt19937(42));
+    printf("%zu bodies, sizeof(Body) = %zu bytes\n", count, sizeof(Body));
+
+    vector<double> gravity(count), escape(count);
+    auto pointerPhysics = [&](auto& bodies) {
+        for (size_t i = 0; i < bodies.size(); i++) {
+            gravity[i] = bodies[i]->calculateSurfaceGravity();
+            escape[i] = bodies[i]->calculateEscapeVelocity();
+        }
+        return gravity[count / 2] + escape[count / 3];
+    };
+    auto pointerImpacts = [&](auto& bodies) {
+        double total = 0;
+        for (const auto& body : bodies) {
+            if (auto asteroid = dynamic_cast<const Asteroid*>(&*body)) total += asteroid->calculateImpactEnergy();
+        }
+        return total;
+    };
+
+    measure("gravity + escape, unique_ptr", count, passes, [&] { return pointerPhysics(pointers); });
+    measure("gravity + escape, shuffled", count, passes, [&] { return pointerPhysics(shuffled); });
+    measure("gravity + escape, BodySet", count, passes, [&] {
+        set.surfaceGravities(gravity);
+        set.escapeVelocities(escape);
+        return gravity[count / 2] + escape[count / 3];
+    });
+
+    measure("asteroid impact energy, unique_ptr", count, passes, [&] { return pointerImpacts(pointers); });
+    measure("asteroid impact energy, shuffled", count, passes, [&] { return pointerImpacts(shuffled); });
+    measure("asteroid impact energy, BodySet", count, passes, [&] {
+        double total = 0;
+        for (const auto& body : set.all()) {
+            if (auto asteroid = get_if<Asteroid>(&body)) total += asteroid->calculateImpactEnergy();
+        }
+        return total;
+    });
+    return 0;
+}
@@ -0,0 +1,77 @@
+// bench_common.h
+//
+// Helpers shared by the bench_*.cpp programs.
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include "src/get_data.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace bench {
+
+using json = nlohmann::json;
+
+// Writes a feed with every date of the source repeated `scale` times.
+// Dates are suffixed with the copy number so they stay unique.
+inline std::string writeScaledFeed(const std::string& source, int scale) {
+    json feed;
+    if (!load_from_file(feed, source)) exit(1);
+
+    std::string path = "/tmp/bench_feed_x" + std::to_string(scale) + ".json";
+    std::ofstream out(path);
+    out << "{\"element_count\": " << feed["element_count"].get<long>() * scale
+        << ", \"near_earth_objects\": {";
+    bool first = true;
+    for (int copy = 0; copy < scale; copy++) {
+        for (const auto& entry : feed["near_earth_objects"].items()) {
+            out << (first ? "" : ",") << "\"" << entry.key() << "#" << copy << "\": " << entry.value().dump();
+            first = false;
+        }
+    }
+    out << "}}";
+    return path;
+}
+
+inline double fileSizeMb(const std::string& path) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) return -1.0;
+    return info.st_size / (1024.0 * 1024.0);
+}
+
+inline double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs body() in a child process so its peak RSS is measured on its own.
+// The child prints its own result line; this appends the peak RSS to it.
+template <typename Body>
+void runIsolated(Body body) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        body();
+        fflush(stdout);
+        _exit(0);
+    }
+    int status = 0;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+#ifdef __APPLE__
+    double peakMb = usage.ru_maxrss / (1024.0 * 1024.0); // bytes on macOS
+#else
+    double peakMb = usage.ru_maxrss / 1024.0;            // kilobytes on Linux
+#endif
+    printf(" %10.1f MB peak RSS\n", peakMb);
+}
+
+} // namespace bench
+
+#endif // BENCH_COMMON_H
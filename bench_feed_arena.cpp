@@ -0,0 +1,110 @@
+// bench_feed_arena.cpp
+//
+// Load-and-discard cycles of a large synthetic feed (data.json repeated
+// `scale` times), timing the load and the discard separately:
+//   heap    extract_feed_fields, then a vector<Asteroid> on the default
+//           resource, every string freed one by one on discard
+//   arena   hydrate_feed into an AsteroidFeed, discarded with clear()
+// Both run on one thread. Allocations and frees per cycle are counted by
+// replacing the global operator new.
+//
+// Usage: ./bench_feed_arena [scale] [cycles]
+
+#include "bench_common.h"
+#include "src/feed_hydration.h"
+#include <atomic>
+#include <new>
+
+using namespace std;
+
+static atomic<size_t> allocations(0);
+static atomic<size_t> frees(0);
+
+void* operator new(size_t size) {
+    void* block = malloc(size);
+    if (!block) throw bad_alloc();
+    allocations++;
+    return block;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    frees++;
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+// pmr::new_delete_resource() allocates through the aligned forms
+void* operator new(size_t size, align_val_t alignment) {
+    void* block = aligned_alloc(static_cast<size_t>(alignment), (size + static_cast<size_t>(alignment) - 1) &
+                                                                    ~(static_cast<size_t>(alignment) - 1));
+    if (!block) throw bad_alloc();
+    allocations++;
+    return block;
+}
+
+void operator delete(void* pointer, align_val_t) noexcept {
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, size_t, align_val_t) noexcept {
+    operator delete(pointer);
+}
+
+template <typename Load, typename Discard>
+static void measure(const char* label, size_t records, int cycles, Load load, Discard discard) {
+    double loadSeconds = 0, discardSeconds = 0;
+    size_t loadAllocations = 0, discardFrees = 0;
+    for (int cycle = 0; cycle < cycles; cycle++) {
+        size_t allocated = allocations;
+        auto start = chrono::steady_clock::now();
+        size_t loaded = load();
+        loadSeconds += bench::secondsSince(start);
+        loadAllocations += allocations - allocated;
+        if (loaded != records) {
+            fprintf(stderr, "%s: loaded %zu of %zu records\n", label, loaded, records);
+        }
+
+        size_t freed = frees;
+        start = chrono::steady_clock::now();
+        discard();
+        discardSeconds += bench::secondsSince(start);
+        discardFrees += frees - freed;
+    }
+    printf("%-6s load %8.2f ms  discard %7.3f ms  %8.2f allocations/record on load  %8.2f frees/record on discard\n",
+           label, loadSeconds / cycles * 1e3, discardSeconds / cycles * 1e3,
+           double(loadAllocations) / cycles / records, double(discardFrees) / cycles / records);
+}
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? atoi(argv[1]) : 100;
+    int cycles = argc > 2 ? atoi(argv[2]) : 10;
+
+    json feed;
+    if (!load_from_file(feed, bench::writeScaledFeed("data.json", scale))) return 1;
+    size_t records = feed["element_count"].get<size_t>();
+    printf("%zu records per feed, %d cycles\n", records, cycles);
+
+    vector<Asteroid> heap;
+    measure("heap", records, cycles, [&] {
+        FeedFields fields;
+        extract_feed_fields(feed, fields, 1);
+        heap.reserve(fields.rows.size());
+        for (auto& row : fields.rows) heap.emplace_back(std::move(row));
+        return heap.size();
+    }, [&] {
+        vector<Asteroid>().swap(heap);
+    });
+
+    AsteroidFeed arena;
+    measure("arena", records, cycles, [&] {
+        hydrate_feed(feed, arena, 1);
+        return arena.asteroids.size();
+    }, [&] {
+        arena.clear();
+    });
+    return 0;
+}
@@ -0,0 +1,63 @@
+// bench_feed_hydration.cpp
+//
+// Records hydrated per second from a parsed feed: the per-object path
+// (one Asteroid(json) per NEO, date by date) versus hydrate_feed and
+// extract_feed_fields at several thread counts.
+//
+// Usage: ./bench_feed_hydration [scale] [passes]
+//   scale: how many times data.json is repeated in the feed
+
+#include "bench_common.h"
+#include "src/feed_hydration.h"
+#include <iostream>
+#include <thread>
+
+using namespace std;
+
+template <typename Hydrate>
+static void measure(const string& label, size_t records, int passes, Hydrate hydrate) {
+    auto start = chrono::steady_clock::now();
+    size_t hydrated = 0;
+    for (int pass = 0; pass < passes; pass++) hydrated += hydrate();
+    double seconds = bench::secondsSince(start);
+    if (hydrated != records * passes) {
+        cerr << label << ": hydrated " << hydrated << " of " << records * passes << " records" << endl;
+    }
+    printf("%-24s %8.2f M records/s   %8.2f ms per feed\n", label.c_str(), hydrated / seconds / 1e6,
+           seconds / passes * 1e3);
+}
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? atoi(argv[1]) : 20;
+    int passes = argc > 2 ? atoi(argv[2]) : 10;
+
+    json feed;
+    if (!load_from_file(feed, bench::writeScaledFeed("data.json", scale))) return 1;
+    size_t records = feed["element_count"].get<size_t>();
+    printf("%zu records over %zu dates, %u hardware threads\n", records, feed["near_earth_objects"].size(),
+           thread::hardware_concurrency());
+
+    measure("per-object Asteroid(json)", records, passes, [&] {
+        vector<Asteroid> asteroids;
+        asteroids.reserve(records);
+        for (const auto& date : feed["near_earth_objects"].items()) {
+            for (const auto& neo : date.value()) asteroids.emplace_back(neo);
+        }
+        return asteroids.size();
+    });
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        measure("hydrate_feed, " + to_string(threads) + " threads", records, passes, [&] {
+            AsteroidFeed table;
+            hydrate_feed(feed, table, threads);
+            return table.asteroids.size();
+        });
+    }
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        measure("extract_feed_fields, " + to_string(threads), records, passes, [&] {
+            FeedFields fields;
+            extract_feed_fields(feed, fields, threads);
+            return fields.rows.size();
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+// bench_fetch_session.cpp
+//
+// Per-request latency of repeated fetches with a fresh curl handle per
+// request (the previous fetch_neo_data) versus a reused FetchSession.
+// By default the requests go to local_http_server.h serving data.json;
+// pass a URL to measure against a real endpoint, where TLS handshakes and
+// DNS lookups make the difference much larger.
+//
+// Usage: ./bench_fetch_session [requests] [url]
+
+#include "bench_common.h"
+#include "local_http_server.h"
+#include "src/fetch_session.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+// The previous fetch_neo_data: new handle, new connection, identity encoding
+static bool fetchWithFreshHandle(const string& url, string& body) {
+    CURL* curl = curl_easy_init();
+    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+    CURLcode res = curl_easy_perform(curl);
+    curl_easy_cleanup(curl);
+    return res == CURLE_OK;
+}
+
+template <typename Fetch>
+static void measure(const char* label, int requests, const string& url, Fetch fetch) {
+    vector<double> latencies;
+    size_t bytes = 0;
+    for (int i = 0; i < requests; i++) {
+        string body;
+        auto start = chrono::steady_clock::now();
+        if (!fetch(url, body)) {
+            cerr << label << ": request failed" << endl;
+            return;
+        }
+        latencies.push_back(bench::secondsSince(start) * 1e6);
+        bytes += body.size();
+    }
+    sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (double latency : latencies) total += latency;
+    printf("%-14s mean %9.1f us   p50 %9.1f us   p99 %9.1f us   %zu bytes/request\n", label,
+           total / requests, latencies[requests / 2], latencies[requests * 99 / 100], bytes / requests);
+}
+
+int main(int argc, char** argv) {
+    int requests = argc > 1 ? atoi(argv[1]) : 200;
+    string url = argc > 2 ? argv[2] : "";
+
+    unique_ptr<LocalHttpServer> server;
+    if (url.empty()) {
+        ifstream file("data.json");
+        string feed((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        server.reset(new LocalHttpServer([feed](const string&) { return feed; }));
+        url = server->url();
+    }
+    printf("%d requests to %s\n", requests, url.c_str());
+
+    measure("fresh handle", requests, url, fetchWithFreshHandle);
+    if (server) printf("  connections opened: %d\n", server->connectionCount());
+
+    FetchSession session;
+    int before = server ? server->connectionCount() : 0;
+    measure("session", requests, url, [&session](const string& target, string& body) {
+        return session.get(target, body);
+    });
+    if (server) printf("  connections opened: %d\n", server->connectionCount() - before);
+    return 0;
+}
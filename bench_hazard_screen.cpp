@@ -0,0 +1,58 @@
+// bench_hazard_screen.cpp
+//
+// Screening a large feed for the K most hazardous close approaches, two ways:
+// streaming every NEO from disk through a HazardScreen, and loading the whole
+// feed into Asteroids and sorting every approach by each criterion.
+// Each runs in its own child process so peak RSS is not shared; the streamed
+// screen should stay flat as the feed grows.
+//
+// Usage: ./bench_hazard_screen [scale] [k]
+
+#include "bench_common.h"
+#include "src/hazard_screen.h"
+#include "src/neo_stream.h"
+#include <algorithm>
+
+using namespace std;
+
+static const int64_t reference = 1704067200000; // 2024-01-01T00:00Z
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? atoi(argv[1]) : 100;
+    size_t k = argc > 2 ? strtoul(argv[2], nullptr, 10) : 10;
+    string path = bench::writeScaledFeed("data.json", scale);
+    printf("Input: %s (%.1f MB), K = %zu\n", path.c_str(), bench::fileSizeMb(path), k);
+
+    bench::runIsolated([&] {
+        auto start = chrono::steady_clock::now();
+        HazardScreen screen(k, reference);
+        stream_from_file(path, [&](const string&, const Asteroid& asteroid) { screen.add(asteroid); });
+        double seconds = bench::secondsSince(start);
+        printf("%-12s %9zu approaches %8.3f s   top score %.3f", "stream+topK", screen.screened(), seconds,
+               screen.top(HazardCriterion::Palermo)[0].palermo);
+    });
+
+    bench::runIsolated([&] {
+        auto start = chrono::steady_clock::now();
+        json feed;
+        if (!load_from_file(feed, path)) return;
+        vector<Asteroid> asteroids;
+        for (const auto& entry : feed["near_earth_objects"].items()) {
+            for (const auto& neo : entry.value()) {
+                asteroids.emplace_back(neo);
+            }
+        }
+        // Screening everything keeps every approach, then sorts each criterion
+        HazardScreen all(SIZE_MAX / 2, reference);
+        for (const auto& asteroid : asteroids) {
+            all.add(asteroid);
+        }
+        vector<HazardEntry> scores = all.top(HazardCriterion::Palermo);
+        all.top(HazardCriterion::ImpactEnergy);
+        all.top(HazardCriterion::MissDistance);
+        double seconds = bench::secondsSince(start);
+        printf("%-12s %9zu approaches %8.3f s   top score %.3f", "load+sort", all.screened(), seconds,
+               scores[0].palermo);
+    });
+    return 0;
+}
@@ -0,0 +1,68 @@
+// bench_impact_matrix.cpp
+//
+// Asteroid x planet impact matrix over the asteroids of data.json repeated
+// up to `rows` times: a straightforward loop over each pair with the
+// BodyPhysics formulas, against compute_impact_matrix at several thread
+// counts, in million cells per second.
+//
+// Usage: ./bench_impact_matrix [rows]
+
+#include "bench_common.h"
+#include "src/body_physics.h"
+#include "src/impact_matrix.h"
+#include <thread>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    size_t rows = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000000;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    AsteroidTable table;
+    table.loadFeed(feed);
+    vector<double> masses(rows), velocities(rows);
+    for (size_t i = 0; i < rows; i++) {
+        masses[i] = table.mass()[i % table.size()];
+        velocities[i] = table.firstVelocityKmPerS(i % table.size());
+    }
+    const auto& planets = SolarSystem::predefinedPlanets;
+    double cells = double(rows) * planets.size();
+    printf("%zu asteroids x %zu planets, %u hardware threads\n", rows, planets.size(), thread::hardware_concurrency());
+
+    // One pair at a time, asteroid by asteroid
+    ImpactMatrix naive;
+    naive.velocities.resize(rows * planets.size());
+    naive.energies.resize(rows * planets.size());
+    naive.massChanges.resize(rows * planets.size());
+    auto start = chrono::steady_clock::now();
+    for (size_t a = 0; a < rows; a++) {
+        for (size_t p = 0; p < planets.size(); p++) {
+            double velocity = hypot(velocities[a], planets[p].escapeVelocity);
+            naive.velocities[a * planets.size() + p] = velocity;
+            naive.energies[a * planets.size() + p] = BodyPhysics::impactEnergy(masses[a], velocity);
+            naive.massChanges[a * planets.size() + p] = -masses[a] / planets[p].mass;
+        }
+    }
+    double seconds = bench::secondsSince(start);
+    printf("%-24s %8.1f M cells/s\n", "per pair", cells / seconds / 1e6);
+
+    ImpactMatrix reference;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        ImpactMatrix matrix;
+        compute_impact_matrix(masses.data(), velocities.data(), rows, matrix); // Warm the output pages
+        start = chrono::steady_clock::now();
+        compute_impact_matrix(masses.data(), velocities.data(), rows, matrix, threads);
+        seconds = bench::secondsSince(start);
+        if (threads == 1) reference = matrix;
+        bool same = matrix.energies == reference.energies && matrix.velocities == reference.velocities;
+        printf("blocked, %u threads       %8.1f M cells/s   %s\n", threads, cells / seconds / 1e6,
+               same ? "identical to 1 thread" : "DIFFERS from 1 thread");
+    }
+
+    start = chrono::steady_clock::now();
+    export_impact_matrix(reference, ImpactQuantity::Energy, "/tmp/bench_impact_matrix.csv");
+    printf("CSV export of energies   %8.3f s (%.1f MB)\n", bench::secondsSince(start),
+           bench::fileSizeMb("/tmp/bench_impact_matrix.csv"));
+    return 0;
+}
@@ -0,0 +1,56 @@
+// bench_impact_monte_carlo.cpp
+//
+// Samples per second of ImpactMonteCarlo over a catalogue built from
+// data.json repeated `scale` times, at several thread counts, and whether
+// each thread count reproduced the single-threaded percentiles exactly.
+//
+// Usage: ./bench_impact_monte_carlo [scale] [samples]
+
+#include "bench_common.h"
+#include "src/impact_monte_carlo.h"
+#include <thread>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    int scale = argc > 1 ? atoi(argv[1]) : 10;
+    size_t samples = argc > 2 ? strtoul(argv[2], nullptr, 10) : 10000;
+
+    json feed;
+    if (!load_from_file(feed, bench::writeScaledFeed("data.json", scale))) return 1;
+    AsteroidTable table;
+    table.loadFeed(feed);
+    vector<ImpactBody> bodies = ImpactMonteCarlo::bodiesOf(table);
+
+    ImpactUncertainty model;
+    model.samples = samples;
+    model.percentiles = {5, 50, 95};
+    ImpactMonteCarlo engine(model);
+    printf("%zu asteroids x %zu samples, %u hardware threads\n", bodies.size(), samples,
+           thread::hardware_concurrency());
+
+    // Sampling alone, without the percentile selection
+    auto start = chrono::steady_clock::now();
+    double sink = 0;
+    for (size_t body = 0; body < bodies.size(); body++) {
+        for (size_t i = 0; i < samples; i++) sink += engine.sample(bodies[body], body, static_cast<uint32_t>(i));
+    }
+    double seconds = bench::secondsSince(start);
+    printf("%-22s %8.2f M samples/s   (checksum %.3g)\n", "sample() only, 1 thread",
+           bodies.size() * samples / seconds / 1e6, sink);
+
+    ImpactEnergyStats reference;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        ImpactEnergyStats stats;
+        start = chrono::steady_clock::now();
+        engine.run(bodies, stats, threads);
+        seconds = bench::secondsSince(start);
+        if (threads == 1) reference = stats;
+        bool same = stats.energies == reference.energies && stats.means == reference.means;
+        printf("run, %u threads         %8.2f M samples/s   %s\n", threads, bodies.size() * samples / seconds / 1e6,
+               same ? "identical to 1 thread" : "DIFFERS from 1 thread");
+    }
+    printf("asteroid 0: p5 %.4g  p50 %.4g  p95 %.4g MT, nominal %.4g MT\n", reference.energy(0, 0),
+           reference.energy(0, 1), reference.energy(0, 2), table[0].calculateImpactEnergy());
+    return 0;
+}
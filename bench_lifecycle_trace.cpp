@@ -0,0 +1,74 @@
+// bench_lifecycle_trace.cpp
+//
+// Cost of lifecycle logging while a batch of Asteroids is copied and
+// destroyed. "cout + endl" writes the lines the destructors and copy
+// constructor used to print, with a flush per line, to /dev/null (a
+// terminal is slower still). The other rows use LifecycleTrace at each
+// runtime level; build with -DSPACE_BODY_TRACE=0 for the compiled-out case.
+//
+// Usage: ./bench_lifecycle_trace [asteroids] [passes]
+
+#include "bench_common.h"
+#include "src/feed_hydration.h"
+#include "src/lifecycle_trace.h"
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+template <typename Cycle>
+static void measure(const char* label, size_t count, int passes, Cycle cycle) {
+    double best = 1e30;
+    for (int pass = 0; pass < passes; pass++) {
+        auto start = chrono::steady_clock::now();
+        cycle();
+        best = min(best, bench::secondsSince(start));
+    }
+    printf("%-26s %8.1f ns/asteroid\n", label, best * 1e9 / count);
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000;
+    int passes = argc > 2 ? atoi(argv[2]) : 5;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    FeedFields source;
+    extract_feed_fields(feed, source, 1);
+    vector<Asteroid> originals;
+    originals.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        originals.emplace_back(source.rows[i % source.rows.size()]);
+    }
+    printf("%zu asteroids, tracing %s\n", count, SPACE_BODY_TRACE ? "compiled in" : "compiled out");
+
+    // Copy every asteroid, then destroy the copies
+    auto cycle = [&] {
+        vector<Asteroid> copies;
+        copies.reserve(count);
+        for (const auto& asteroid : originals) copies.push_back(asteroid);
+    };
+
+    ofstream devNull("/dev/null");
+    measure("cout + endl (previous)", count, passes, [&] {
+        vector<Asteroid> copies;
+        copies.reserve(count);
+        for (const auto& asteroid : originals) {
+            copies.push_back(asteroid);
+            devNull << "Asteroid " << asteroid.getName() << " copied." << endl;
+        }
+        for (const auto& copy : copies) {
+            devNull << "Asteroid " << copy.getName() << " memory freed." << endl;
+            devNull << "Space body " << copy.getName() << " memory freed." << endl;
+        }
+    });
+
+    LifecycleTrace::setLevel(TraceLevel::Off);
+    measure("trace level Off", count, passes, cycle);
+    LifecycleTrace::setLevel(TraceLevel::Lifecycle);
+    measure("trace level Lifecycle", count, passes, cycle);
+    LifecycleTrace::setLevel(TraceLevel::Verbose);
+    measure("trace level Verbose", count, passes, cycle);
+    LifecycleTrace::setLevel(TraceLevel::Off);
+    return 0;
+}
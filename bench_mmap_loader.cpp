@@ -0,0 +1,94 @@
+// bench_mmap_loader.cpp
+//
+// Load times of a feed file through a buffered ifstream (the previous
+// load_from_file) versus the memory-mapped path, for both the DOM parser
+// and the SAX streaming loader. Every loader is timed with a cold page
+// cache (file pages dropped before the run) and a warm one.
+//
+// Usage: ./bench_mmap_loader [feed.json] [scale]
+//   A scale of ~20000 turns data.json into a feed of several GB.
+//   Cold runs need posix_fadvise; elsewhere only warm numbers are shown.
+
+#include "bench_common.h"
+#include "src/classes.h"
+#include "src/mapped_file.h"
+#include "src/neo_stream.h"
+#include <fcntl.h>
+
+using namespace std;
+using json = nlohmann::json;
+
+// Asks the kernel to forget the cached pages of the file
+static bool dropPageCache(const string& path) {
+#ifdef POSIX_FADV_DONTNEED
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    fdatasync(fd);
+    bool dropped = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(fd);
+    return dropped;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+static size_t domIfstream(const string& path) {
+    ifstream file(path);
+    json feed;
+    file >> feed;
+    return feed["near_earth_objects"].size();
+}
+
+static size_t domMapped(const string& path) {
+    json feed;
+    load_from_file(feed, path);
+    return feed["near_earth_objects"].size();
+}
+
+static size_t streamIfstream(const string& path) {
+    ifstream file(path, ios::binary);
+    size_t count = 0;
+    stream_neo_data(file, [&](const string&, const Asteroid&) { count++; });
+    return count;
+}
+
+static size_t streamMapped(const string& path) {
+    size_t count = 0;
+    stream_from_file(path, [&](const string&, const Asteroid&) { count++; });
+    return count;
+}
+
+static void measure(const char* label, size_t (*loader)(const string&), const string& path,
+                    double fileMb, bool cold) {
+    if (cold && !dropPageCache(path)) return;
+    bench::runIsolated([&] {
+        auto start = chrono::steady_clock::now();
+        loader(path);
+        double seconds = bench::secondsSince(start);
+        printf("%-16s %-5s %10.3f s %10.1f MB/s", label, cold ? "cold" : "warm", seconds, fileMb / seconds);
+    });
+}
+
+int main(int argc, char** argv) {
+    string path = argc > 1 ? argv[1] : "data.json";
+    int scale = argc > 2 ? atoi(argv[2]) : 1;
+    if (scale > 1) {
+        path = bench::writeScaledFeed(path, scale);
+    }
+
+    double fileMb = bench::fileSizeMb(path);
+    if (fileMb < 0) {
+        cerr << "Could not open " << path << endl;
+        return 1;
+    }
+    printf("Input: %s (%.1f MB)\n", path.c_str(), fileMb);
+
+    for (bool cold : {true, false}) {
+        measure("dom ifstream", domIfstream, path, fileMb, cold);
+        measure("dom mmap", domMapped, path, fileMb, cold);
+        measure("stream ifstream", streamIfstream, path, fileMb, cold);
+        measure("stream mmap", streamMapped, path, fileMb, cold);
+    }
+    return 0;
+}
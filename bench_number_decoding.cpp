@@ -0,0 +1,81 @@
+// bench_number_decoding.cpp
+//
+// Decoding rate of the string-encoded numbers of every close approach in
+// data.json (seven units each). "stod" copies each value out with
+// get<string>() and converts it with std::stod, as the Asteroid constructor
+// used to; "from_chars" is decode_close_approaches.
+//
+// Usage: ./bench_number_decoding [passes over data.json]
+
+#include "bench_common.h"
+#include "src/neo_numbers.h"
+#include <vector>
+
+using namespace std;
+
+static const pair<const char*, const char*> units[] = {
+    {"relative_velocity", "kilometers_per_second"},
+    {"relative_velocity", "kilometers_per_hour"},
+    {"relative_velocity", "miles_per_hour"},
+    {"miss_distance", "astronomical"},
+    {"miss_distance", "lunar"},
+    {"miss_distance", "kilometers"},
+    {"miss_distance", "miles"},
+};
+
+template <typename Decode>
+static void measure(const char* label, const vector<const json*>& lists, size_t values, int passes, Decode decode) {
+    auto start = chrono::steady_clock::now();
+    double checksum = 0;
+    for (int pass = 0; pass < passes; pass++) {
+        for (const json* list : lists) checksum += decode(*list);
+    }
+    double seconds = bench::secondsSince(start);
+    double count = static_cast<double>(values) * passes;
+    printf("%-12s %8.1f M values/s   %6.1f ns each   (checksum %g)\n", label, count / seconds / 1e6,
+           seconds / count * 1e9, checksum);
+}
+
+int main(int argc, char** argv) {
+    int passes = argc > 1 ? atoi(argv[1]) : 500;
+
+    json feed;
+    if (!load_from_file(feed, "data.json")) return 1;
+    vector<const json*> lists;
+    size_t approaches = 0;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            lists.push_back(&neo["close_approach_data"]);
+            approaches += neo["close_approach_data"].size();
+        }
+    }
+    size_t values = approaches * (sizeof(units) / sizeof(units[0]));
+    printf("%zu close approaches, %zu values x %d passes\n", approaches, values, passes);
+
+    measure("stod", lists, values, passes, [](const json& list) {
+        double sum = 0;
+        for (const auto& approach : list) {
+            for (const auto& unit : units) {
+                sum += stod(approach.at(unit.first).at(unit.second).get<string>());
+            }
+        }
+        return sum;
+    });
+
+    vector<ApproachNumbers> numbers;
+    measure("from_chars", lists, values, passes, [&numbers](const json& list) {
+        numbers.clear();
+        NumberError error;
+        if (!decode_close_approaches(list, numbers, &error)) {
+            fprintf(stderr, "%s %s\n", error.field.c_str(), error.reason.c_str());
+            exit(1);
+        }
+        double sum = 0;
+        for (const auto& n : numbers) {
+            sum += n.velocityKmPerS + n.velocityKmPerH + n.velocityMilesPerH + n.missAstronomical + n.missLunar +
+                   n.missKm + n.missMiles;
+        }
+        return sum;
+    });
+    return 0;
+}
@@ -0,0 +1,90 @@
+// bench_stream_fetch.cpp
+//
+// Time to first record and total latency of a feed download that is parsed
+// after the transfer (FetchSession::get + json::parse, as fetch_neo_data
+// does) versus one parsed while it arrives (stream_neo_url).
+// By default local_http_server.h serves data.json in paced chunks to stand
+// in for a slow link; pass a URL to measure against a real endpoint.
+//
+// Usage: ./bench_stream_fetch [runs] [chunk KiB] [delay ms per chunk] [url]
+
+#include "bench_common.h"
+#include "local_http_server.h"
+#include "src/stream_fetch.h"
+#include <iostream>
+#include <memory>
+
+using namespace std;
+
+struct Timing {
+    double firstRecord = 0;
+    double total = 0;
+    size_t records = 0;
+};
+
+// The buffered path: whole body first, then the DOM, then the asteroids
+static bool fetchThenParse(FetchSession& session, const string& url, Timing& timing) {
+    auto start = chrono::steady_clock::now();
+    string body;
+    if (!session.get(url, body)) return false;
+    json feed = json::parse(body, nullptr, false);
+    if (feed.is_discarded()) return false;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            Asteroid asteroid(neo);
+            if (timing.records++ == 0) timing.firstRecord = bench::secondsSince(start);
+        }
+    }
+    timing.total = bench::secondsSince(start);
+    return true;
+}
+
+static bool fetchWhileParsing(FetchSession& session, const string& url, Timing& timing) {
+    StreamFetchStats stats;
+    if (!stream_neo_url(session, url, [](const string&, const Asteroid&) {}, &stats)) return false;
+    timing.firstRecord = stats.firstRecordSeconds;
+    timing.total = stats.totalSeconds;
+    timing.records = stats.records;
+    return true;
+}
+
+template <typename Fetch>
+static void measure(const char* label, int runs, const string& url, Fetch fetch) {
+    FetchSession session;
+    Timing sum;
+    for (int i = 0; i < runs; i++) {
+        Timing timing;
+        if (!fetch(session, url, timing)) {
+            cerr << label << ": request failed" << endl;
+            return;
+        }
+        sum.firstRecord += timing.firstRecord;
+        sum.total += timing.total;
+        sum.records = timing.records;
+    }
+    printf("%-16s first record %8.2f ms   total %8.2f ms   %zu records\n", label,
+           sum.firstRecord / runs * 1e3, sum.total / runs * 1e3, sum.records);
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? atoi(argv[1]) : 5;
+    size_t chunkKib = argc > 2 ? atoi(argv[2]) : 16;
+    int delayMs = argc > 3 ? atoi(argv[3]) : 10;
+    string url = argc > 4 ? argv[4] : "";
+
+    unique_ptr<LocalHttpServer> server;
+    if (url.empty()) {
+        ifstream file("data.json");
+        string feed((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+        server.reset(new LocalHttpServer([feed](const string&) { return feed; }));
+        server->throttle(chunkKib * 1024, delayMs);
+        url = server->url();
+        printf("%d runs, %zu KiB every %d ms from %s\n", runs, chunkKib, delayMs, url.c_str());
+    } else {
+        printf("%d runs against %s\n", runs, url.c_str());
+    }
+
+    measure("fetch then parse", runs, url, fetchThenParse);
+    measure("stream", runs, url, fetchWhileParsing);
+    return 0;
+}
@@ -0,0 +1,64 @@
+// bench_stream_loader.cpp
+//
+// Compares the DOM loader (load_from_file) with the SAX streaming loader
+// (stream_from_file) on throughput and peak resident memory.
+// Each loader runs in its own child process so peak RSS is not shared.
+//
+// Usage: ./bench_stream_loader [feed.json] [scale]
+//   scale > 1 writes a synthetic feed with the NEOs of feed.json repeated
+//   under `scale` times as many dates.
+
+#include "bench_common.h"
+#include "src/classes.h"
+#include "src/neo_stream.h"
+
+using namespace std;
+using json = nlohmann::json;
+
+static size_t runDom(const string& path) {
+    json feed;
+    if (!load_from_file(feed, path)) return 0;
+    size_t count = 0;
+    for (const auto& entry : feed["near_earth_objects"].items()) {
+        for (const auto& neo : entry.value()) {
+            Asteroid asteroid(neo);
+            count++;
+        }
+    }
+    return count;
+}
+
+static size_t runStream(const string& path) {
+    size_t count = 0;
+    stream_from_file(path, [&](const string&, const Asteroid&) { count++; });
+    return count;
+}
+
+static void measure(const char* label, size_t (*loader)(const string&), const string& path, double fileMb) {
+    bench::runIsolated([&] {
+        auto start = chrono::steady_clock::now();
+        size_t count = loader(path);
+        double seconds = bench::secondsSince(start);
+        printf("%-8s %10zu NEOs %10.3f s %10.1f MB/s %12.0f NEOs/s", label, count, seconds,
+               fileMb / seconds, count / seconds);
+    });
+}
+
+int main(int argc, char** argv) {
+    string path = argc > 1 ? argv[1] : "data.json";
+    int scale = argc > 2 ? atoi(argv[2]) : 1;
+    if (scale > 1) {
+        path = bench::writeScaledFeed(path, scale);
+    }
+
+    double fileMb = bench::fileSizeMb(path);
+    if (fileMb < 0) {
+        cerr << "Could not open " << path << endl;
+        return 1;
+    }
+    printf("Input: %s (%.1f MB)\n", path.c_str(), fileMb);
+
+    measure("dom", runDom, path, fileMb);
+    measure("stream", runStream, path, fileMb);
+    return 0;
+}
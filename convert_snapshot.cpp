@@ -0,0 +1,35 @@
+// convert_snapshot.cpp
+//
+// Converts a NeoWs feed file into the binary snapshot main.cpp falls back to.
+//
+// Usage: ./convert_snapshot [feed.json] [output.snapshot]
+
+#include "src/neo_snapshot.h"
+#include <chrono>
+#include <iostream>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    string feedFilename = argc > 1 ? argv[1] : "data.json";
+    string snapshotFilename = argc > 2 ? argv[2] : "data.snapshot";
+
+    if (!write_snapshot(feedFilename, snapshotFilename)) {
+        cerr << "Failed to convert " << feedFilename << endl;
+        return 1;
+    }
+
+    // Open the result once to check it and show how cheap loading is
+    auto start = chrono::steady_clock::now();
+    NeoSnapshot snapshot;
+    if (!snapshot.open(snapshotFilename)) {
+        cerr << "Failed to read back " << snapshotFilename << endl;
+        return 1;
+    }
+    double micros = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+
+    cout << "Wrote " << snapshot.size() << " NEOs and " << snapshot.approachCount()
+         << " close approaches to " << snapshotFilename << endl;
+    cout << "Snapshot opened in " << micros << " us" << endl;
+    return 0;
+}
@@ -0,0 +1,216 @@
+// local_http_server.h
+//
+// Minimal HTTP/1.1 server on 127.0.0.1 that stands in for the NeoWs API in
+// tests and benchmarks. Every request is answered by a handler with a
+// canned body, and optionally a status other than 200, after an injected
+// latency. Connections are kept alive until
+// the client closes them. The server counts connections and tracks the
+// peak number of requests in flight. throttle() makes it send bodies in
+// paced chunks, like a slow link.
+//
+// POSIX sockets only.
+
+#ifndef LOCAL_HTTP_SERVER_H
+#define LOCAL_HTTP_SERVER_H
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+class LocalHttpServer {
+public:
+    struct Response {
+        int status;
+        std::string body;
+    };
+
+    // Receives the request target ("/feed?start_date=...") and returns the body
+    using Handler = std::function<std::string(const std::string& target)>;
+    // Same, also choosing the status of the response
+    using Responder = std::function<Response(const std::string& target)>;
+
+    explicit LocalHttpServer(Handler handler, int latencyMs = 0)
+        : LocalHttpServer(Responder([handler](const std::string& target) { return Response{200, handler(target)}; }),
+                          latencyMs) {}
+
+    explicit LocalHttpServer(Responder responder, int latencyMs = 0)
+        : responder(std::move(responder)), latencyMs(latencyMs), running(true),
+          connections(0), requests(0), inFlight(0), peakInFlight(0), chunkBytes(0), chunkDelayMs(0) {
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0; // Any free port
+        bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(listenFd, 64);
+        socklen_t length = sizeof(address);
+        getsockname(listenFd, reinterpret_cast<sockaddr*>(&address), &length);
+        listenPort = ntohs(address.sin_port);
+        acceptThread = std::thread([this] { acceptLoop(); });
+    }
+
+    ~LocalHttpServer() {
+        running = false;
+        shutdown(listenFd, SHUT_RDWR);
+        close(listenFd);
+        acceptThread.join();
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            for (int fd : clientFds) shutdown(fd, SHUT_RDWR);
+        }
+        for (auto& worker : workers) worker.join();
+    }
+
+    // Sends bodies chunkBytes at a time with chunkDelayMs between chunks
+    void throttle(size_t bytes, int delayMs) {
+        chunkBytes = bytes;
+        chunkDelayMs = delayMs;
+    }
+
+    int port() const { return listenPort; }
+    std::string url(const std::string& path = "/feed") const {
+        return "http://127.0.0.1:" + std::to_string(listenPort) + path;
+    }
+    int connectionCount() const { return connections; }
+    int requestCount() const { return requests; }
+    int peakConcurrentRequests() const { return peakInFlight; }
+    std::string lastRequestHead() {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        return lastHead;
+    }
+
+private:
+#ifdef MSG_NOSIGNAL
+    static constexpr int sendFlags = MSG_NOSIGNAL;
+#else
+    static constexpr int sendFlags = 0;
+#endif
+
+    Responder responder;
+    int latencyMs;
+    std::atomic<bool> running;
+    std::atomic<int> connections;
+    std::atomic<int> requests;
+    std::atomic<int> inFlight;
+    std::atomic<int> peakInFlight;
+    std::atomic<size_t> chunkBytes;
+    std::atomic<int> chunkDelayMs;
+    int listenFd;
+    int listenPort;
+    std::thread acceptThread;
+    std::vector<std::thread> workers;
+    std::mutex clientsMutex;
+    std::vector<int> clientFds;
+    std::string lastHead;
+
+    void acceptLoop() {
+        while (running) {
+            int fd = accept(listenFd, nullptr, nullptr);
+            if (fd < 0) {
+                if (!running) return;
+                continue;
+            }
+            connections++;
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            clientFds.push_back(fd);
+            workers.emplace_back([this, fd] { serve(fd); });
+        }
+    }
+
+    // Answers requests on one connection until the client hangs up
+    void serve(int fd) {
+        std::string buffer;
+        char chunk[4096];
+        while (true) {
+            size_t headerEnd;
+            while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+                ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+                if (received <= 0) {
+                    closeClient(fd);
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(received));
+            }
+            std::string head = buffer.substr(0, headerEnd);
+            buffer.erase(0, headerEnd + 4);
+
+            size_t targetBegin = head.find(' ') + 1;
+            std::string target = head.substr(targetBegin, head.find(' ', targetBegin) - targetBegin);
+            std::string lowerHead = head;
+            std::transform(lowerHead.begin(), lowerHead.end(), lowerHead.begin(), ::tolower);
+            bool keepAlive = lowerHead.find("connection: close") == std::string::npos;
+
+            {
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                lastHead = head;
+            }
+            requests++;
+            int now = ++inFlight;
+            int peak = peakInFlight;
+            while (now > peak && !peakInFlight.compare_exchange_weak(peak, now)) {}
+            if (latencyMs > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(latencyMs));
+            }
+            Response response = responder(target);
+            const std::string& body = response.body;
+            inFlight--;
+
+            std::string responseHead = "HTTP/1.1 " + std::to_string(response.status) + " " +
+                                       reasonPhrase(response.status) +
+                                       "\r\nContent-Type: application/json\r\nContent-Length: " +
+                                       std::to_string(body.size()) + "\r\n" +
+                                       (keepAlive ? "" : "Connection: close\r\n") + "\r\n";
+            bool sent = sendAll(fd, responseHead.data(), responseHead.size());
+            size_t step = chunkBytes > 0 ? chunkBytes.load() : body.size();
+            for (size_t offset = 0; sent && offset < body.size(); offset += step) {
+                if (offset > 0 && chunkDelayMs > 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(chunkDelayMs));
+                }
+                sent = sendAll(fd, body.data() + offset, std::min(step, body.size() - offset));
+            }
+            if (!keepAlive || !sent) {
+                closeClient(fd);
+                return;
+            }
+        }
+    }
+
+    static const char* reasonPhrase(int status) {
+        switch (status) {
+        case 200: return "OK";
+        case 404: return "Not Found";
+        case 429: return "Too Many Requests";
+        case 500: return "Internal Server Error";
+        default: return "Status";
+        }
+    }
+
+    bool sendAll(int fd, const char* data, size_t size) {
+        size_t sent = 0;
+        while (sent < size) {
+            ssize_t written = send(fd, data + sent, size - sent, sendFlags);
+            if (written <= 0) return false;
+            sent += static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    void closeClient(int fd) {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        clientFds.erase(std::remove(clientFds.begin(), clientFds.end(), fd), clientFds.end());
+        close(fd);
+    }
+};
+
+#endif // LOCAL_HTTP_SERVER_H
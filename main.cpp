@@ -1,19 +1,18 @@
 #include <SFML/Graphics.hpp>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <vector>
+#include "src/classes.h"
 #include "src/get_data.h"
+#include "src/neo_snapshot.h"
 #include "src/planets.h"
-#include <vector>
-#include <cmath>
-#include <cstdlib>
 #include "json.hpp"
 
 using namespace std;
 
 // Constants for scaling and positioning
-const double EARTH_RADIUS = 6371.0;
 const double SCALE_FACTOR = 0.00001;
 const float WINDOW_CENTER_X = 400;
 const float WINDOW_CENTER_Y = 400;
@@ -38,168 +37,6 @@ void drawSlider(sf::RenderWindow& window, sf::RectangleShape& slider, sf::Rectan
     window.draw(handle);
 }
 
-// SpaceBody Class
-class SpaceBody {
-public:
-    SpaceBody(const string& name, double diameter, double mass)
-        : name(name), diameter(diameter), mass(mass) {}
-
-    virtual void printInfo() const {
-        cout << "Name: " << name << ", Diameter: " << diameter << " km, Mass: " << mass << " kg" << endl;
-    }
-
-    double calculateSurfaceGravity() const {
-        const double G = 6.67430e-11;
-        double radius_m = (diameter * 1000) / 2.0;
-        return (G * mass) / (radius_m * radius_m);
-    }
-
-    double calculateEscapeVelocity() const {
-        const double G = 6.67430e-11;
-        double radiusMeters = (diameter * 1000) / 2.0;
-        double escapeVelocity_m_s = sqrt((2 * G * mass) / radiusMeters);
-        return escapeVelocity_m_s / 1000.0;
-    }
-
-    double getMass() const { return mass; }
-    double getDiameter() const { return diameter; }
-
-    virtual ~SpaceBody() {
-        cout << "Space body " << name << " memory freed." << endl;
-    }
-
-protected:
-    string name;
-    double diameter;
-    double mass;
-};
-
-// Planet Class
-class Planet : public SpaceBody {
-public:
-    Planet(const string& name, double diameter, double mass)
-        : SpaceBody(name, diameter, mass) {}
-
-    void printInfo() const override {
-        cout << "Planet Name: " << name << ", Mass: " << mass << " kg, Diameter: " << diameter << " km" << endl;
-        cout << "Surface Gravity: " << calculateSurfaceGravity() << " m/s^2" << endl;
-        cout << "Escape Velocity: " << calculateEscapeVelocity() << " km/s" << endl;
-    }
-
-    ~Planet() {
-        cout << "Planet " << name << " memory freed." << endl;
-    }
-};
-
-// Asteroid Class
-class Asteroid : public SpaceBody {
-public:
-    Asteroid(const Asteroid& other)
-        : SpaceBody(other.name, other.diameter, other.mass),
-          id(other.id),
-          nasa_jpl_url(other.nasa_jpl_url),
-          absolute_magnitude(other.absolute_magnitude),
-          minDiameterKm(other.minDiameterKm),
-          maxDiameterKm(other.maxDiameterKm),
-          isDangerous(other.isDangerous),
-          closeApproachDate(other.closeApproachDate),
-          relativeVelocityKmPerS(other.relativeVelocityKmPerS),
-          missDistanceKm(other.missDistanceKm) {
-        cout << "Asteroid " << name << " copied." << endl;
-    }
-
-    Asteroid(const json& asteroidData)
-        : SpaceBody(
-            asteroidData["name"],
-            asteroidData["estimated_diameter"]["kilometers"]["estimated_diameter_min"].get<double>(),
-            calculateMass(asteroidData)
-          ),
-          id(asteroidData["id"]),
-          nasa_jpl_url(asteroidData["nasa_jpl_url"]),
-          absolute_magnitude(asteroidData["absolute_magnitude_h"]),
-          isDangerous(asteroidData["is_potentially_hazardous_asteroid"]) {
-        auto diameter = asteroidData["estimated_diameter"];
-        minDiameterKm = diameter["kilometers"]["estimated_diameter_min"].get<double>();
-        maxDiameterKm = diameter["kilometers"]["estimated_diameter_max"].get<double>();
-
-        auto close_approach = asteroidData["close_approach_data"][0];
-        closeApproachDate = close_approach["close_approach_date"];
-        relativeVelocityKmPerS = stod(close_approach["relative_velocity"]["kilometers_per_second"].get<string>());
-        missDistanceKm = stod(close_approach["miss_distance"]["kilometers"].get<string>());
-
-        missDistanceKm = std::max(missDistanceKm / 2.0, EARTH_RADIUS * 2);
-        mass = calculateMass(asteroidData);
-    }
-
-    void printInfo() const override {
-        cout << "Asteroid ID: " << id << endl;
-        cout << "Name: " << name << endl;
-        cout << "NASA JPL URL: " << nasa_jpl_url << endl;
-        cout << "Absolute Magnitude (H): " << absolute_magnitude << endl;
-        cout << "Diameter (Min): " << minDiameterKm << " km, Max: " << maxDiameterKm << " km" << endl;
-        cout << "Is Potentially Hazardous: " << (isDangerous ? "Yes" : "No") << endl;
-        cout << "Close Approach Date: " << closeApproachDate << endl;
-        cout << "Relative Velocity: " << relativeVelocityKmPerS << " km/s" << endl;
-        cout << "Miss Distance: " << missDistanceKm << " km" << endl;
-        cout << "Mass: " << mass << " kg" << endl;
-        cout << "Surface Gravity: " << calculateSurfaceGravity() << " m/s^2" << endl;
-        cout << "Impact Energy: " << calculateImpactEnergy() << " megatons of TNT" << endl;
-    }
-
-    double calculateImpactEnergy() const {
-        double velocity_m_s = relativeVelocityKmPerS * 1000.0;
-        double energy_joules = 0.5 * mass * pow(velocity_m_s, 2);
-        double energy_megatons = energy_joules / 4.184e15;
-        return energy_megatons;
-    }
-
-    Asteroid operator+(const Asteroid& other) const {
-        Asteroid combinedAsteroid(*this);
-
-        combinedAsteroid.name = name + " & " + other.name;
-        combinedAsteroid.minDiameterKm += other.minDiameterKm;
-        combinedAsteroid.maxDiameterKm += other.maxDiameterKm;
-        combinedAsteroid.mass += other.mass;
-        combinedAsteroid.relativeVelocityKmPerS += other.relativeVelocityKmPerS;
-        combinedAsteroid.missDistanceKm += other.missDistanceKm;
-
-        combinedAsteroid.isDangerous = ((combinedAsteroid.minDiameterKm > 280) || (combinedAsteroid.relativeVelocityKmPerS > 5.0));
-        return combinedAsteroid;
-    }
-
-    ~Asteroid() {
-        cout << "Asteroid " << name << " memory freed." << endl;
-    }
-
-private:
-    string id;
-    string nasa_jpl_url;
-    double absolute_magnitude;
-    double minDiameterKm;
-    double maxDiameterKm;
-    bool isDangerous;
-    string closeApproachDate;
-    double relativeVelocityKmPerS;
-    double missDistanceKm;
-
-    static double calculateMass(const json& asteroidData) {
-        const double density = 3000.0;
-        double diameterMin_m = asteroidData["estimated_diameter"]["kilometers"]["estimated_diameter_min"].get<double>() * 1000.0;
-        double diameterMax_m = asteroidData["estimated_diameter"]["kilometers"]["estimated_diameter_max"].get<double>() * 1000.0;
-
-        double radiusMin = diameterMin_m / 2.0;
-        double radiusMax = diameterMax_m / 2.0;
-
-        double volumeMin = (4.0 / 3.0) * M_PI * pow(radiusMin, 3);
-        double volumeMax = (4.0 / 3.0) * M_PI * pow(radiusMax, 3);
-
-        double avgVolume = (volumeMin + volumeMax) / 2.0;
-
-        double mass = density * avgVolume;
-        return mass;
-    }
-};
-
 void handlePlanetOptions(Asteroid& asteroid) {
     bool planetMenu = true;
     while (planetMenu) {
@@ -215,16 +52,16 @@ void handlePlanetOptions(Asteroid& asteroid) {
 
         switch (planetChoice) {
             case 1: {
+                const auto& predefinedPlanets = SolarSystem::predefinedPlanets;
                 for (size_t i = 0; i < predefinedPlanets.size(); ++i) {
                     cout << i + 1 << ". " << predefinedPlanets[i].name << endl;
                 }
                 int planetSelection;
                 cin >> planetSelection;
 
-                if (planetSelection > 0 && planetSelection <= predefinedPlanets.size()) {
-                    const auto& planetData = predefinedPlanets[planetSelection - 1];
-                    Planet planet(planetData.name, planetData.diameter, planetData.mass);
-                    planet.printInfo();
+                if (planetSelection > 0 && static_cast<size_t>(planetSelection) <= predefinedPlanets.size()) {
+                    // The values precomputed in the table, printed as Planet::printInfo does
+                    printPlanetData(predefinedPlanets[planetSelection - 1]);
                 } else {
                     cout << "Invalid selection.\n";
                 }
@@ -330,7 +167,14 @@ int main() {
         if (neo_data.empty()) {
             cerr << "Failed to fetch data from NASA API. Loading data from file..." << endl;
 
-            if (!load_from_file(jsonData, "data.json")) {
+            // Prefer the binary snapshot (see convert_snapshot.cpp), it needs no
+            // parsing; fall back to the JSON file if it does not have the date
+            NeoSnapshot snapshot;
+            if (snapshot.open("data.snapshot")) {
+                jsonData = snapshot.feedForDate(selectedDate);
+            }
+            if (jsonData["near_earth_objects"].empty() &&
+                !load_date_from_file(jsonData, "data.json", selectedDate)) {
                 cerr << "Failed to load data from file." << endl;
                 return 1;
             }
@@ -0,0 +1,81 @@
+// src/approach_index.cpp
+
+#include "approach_index.h"
+#include "body_physics.h"
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+void CloseApproachIndex::build(const vector<NeoFields>& rows) {
+    struct Entry {
+        int64_t epochMs;
+        uint32_t row;
+        uint32_t approach;
+        double missAu;
+    };
+    vector<Entry> entries;
+    for (size_t row = 0; row < rows.size(); row++) {
+        const auto& approaches = rows[row].closeApproaches;
+        for (size_t i = 0; i < approaches.size(); i++) {
+            entries.push_back({approaches[i].epochMs, static_cast<uint32_t>(row), static_cast<uint32_t>(i),
+                               approaches[i].miss_distance / BodyPhysics::kmPerAu});
+        }
+    }
+    sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return tie(a.epochMs, a.row, a.approach) < tie(b.epochMs, b.row, b.approach);
+    });
+
+    size_t count = entries.size();
+    times.resize(count);
+    missAu.resize(count);
+    rowOf.resize(count);
+    approachOf.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        times[i] = entries[i].epochMs;
+        missAu[i] = entries[i].missAu;
+        rowOf[i] = entries[i].row;
+        approachOf[i] = entries[i].approach;
+    }
+
+    leafCount = 1;
+    while (leafCount < count) leafCount *= 2;
+    minTree.assign(2 * leafCount, numeric_limits<double>::infinity());
+    copy(missAu.begin(), missAu.end(), minTree.begin() + leafCount);
+    for (size_t node = leafCount - 1; node > 0; node--) {
+        minTree[node] = min(minTree[2 * node], minTree[2 * node + 1]);
+    }
+}
+
+void CloseApproachIndex::query(int64_t fromMs, int64_t toMs, double maxMissAu, vector<ApproachHit>& out) const {
+    if (times.empty() || fromMs >= toMs) {
+        return;
+    }
+    size_t begin = lower_bound(times.begin(), times.end(), fromMs) - times.begin();
+    size_t end = lower_bound(times.begin(), times.end(), toMs) - times.begin();
+    if (begin < end) {
+        collect(1, 0, leafCount, begin, end, maxMissAu, out);
+    }
+}
+
+size_t CloseApproachIndex::countInRange(int64_t fromMs, int64_t toMs) const {
+    if (fromMs >= toMs) {
+        return 0;
+    }
+    return lower_bound(times.begin(), times.end(), toMs) - lower_bound(times.begin(), times.end(), fromMs);
+}
+
+// Visits the part of [begin, end) under node, skipping subtrees with no approach closer than maxMissAu
+void CloseApproachIndex::collect(size_t node, size_t nodeBegin, size_t nodeEnd, size_t begin, size_t end,
+                                 double maxMissAu, vector<ApproachHit>& out) const {
+    if (nodeEnd <= begin || end <= nodeBegin || !(minTree[node] < maxMissAu)) {
+        return;
+    }
+    if (node >= leafCount) {
+        size_t i = nodeBegin;
+        out.push_back({rowOf[i], approachOf[i], times[i], missAu[i]});
+        return;
+    }
+    size_t middle = (nodeBegin + nodeEnd) / 2;
+    collect(2 * node, nodeBegin, middle, begin, end, maxMissAu, out);
+    collect(2 * node + 1, middle, nodeEnd, begin, end, maxMissAu, out);
+}
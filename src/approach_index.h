@@ -0,0 +1,54 @@
+// src/approach_index.h
+
+#ifndef APPROACH_INDEX_H
+#define APPROACH_INDEX_H
+
+#include <cstdint>
+#include <vector>
+#include "neo_fields.h"
+
+using namespace std;
+
+// One close approach found by CloseApproachIndex::query
+struct ApproachHit {
+    uint32_t row;          // Index of the asteroid in the rows the index was built from
+    uint32_t approach;     // Index of the approach within that asteroid
+    int64_t epochMs;
+    double missDistanceAu; // As reported, not the adjusted distance an Asteroid keeps
+};
+
+// Close approaches of a set of asteroids sorted by time, for range queries
+// such as "every approach between T0 and T1 closer than 0.05 au".
+// The time range is found by binary search. Over the time-sorted approaches
+// sits a segment tree of minimum miss distances, so the query only descends
+// into parts of the range that hold a close enough approach: the cost is
+// O((k + 1) log n) for k results, whatever the size of the time range.
+// Rows are numbered as given to build(), which for FeedFields::rows matches
+// AsteroidTable and AsteroidFeed built from the same feed.
+class CloseApproachIndex {
+public:
+    void build(const vector<NeoFields>& rows);
+
+    size_t size() const { return times.size(); }
+    bool empty() const { return times.empty(); }
+
+    // Approaches with fromMs <= epochMs < toMs and a miss distance under
+    // maxMissAu, appended to out in time order
+    void query(int64_t fromMs, int64_t toMs, double maxMissAu, vector<ApproachHit>& out) const;
+
+    // Approaches with fromMs <= epochMs < toMs, at any distance
+    size_t countInRange(int64_t fromMs, int64_t toMs) const;
+
+private:
+    vector<int64_t> times;
+    vector<double> missAu;
+    vector<uint32_t> rowOf;
+    vector<uint32_t> approachOf;
+    vector<double> minTree; // Node i covers its children 2i and 2i + 1; leaves start at leafCount
+    size_t leafCount = 0;
+
+    void collect(size_t node, size_t nodeBegin, size_t nodeEnd, size_t begin, size_t end, double maxMissAu,
+                 vector<ApproachHit>& out) const;
+};
+
+#endif // APPROACH_INDEX_H
@@ -0,0 +1,258 @@
+// src/asteroid_table.cpp
+
+#include "asteroid_table.h"
+#include "body_kernels.h"
+#include "body_physics.h"
+#include "feed_hydration.h"
+#include <algorithm>
+#include <bitset>
+
+// AsteroidRow Implementations
+string AsteroidRow::getID() const {
+    return table->id(index);
+}
+
+string_view AsteroidRow::getName() const {
+    return table->name(index);
+}
+
+string AsteroidRow::getNasaJplUrl() const {
+    return table->nasaJplUrl(index);
+}
+
+double AsteroidRow::getMass() const {
+    return table->mass()[index];
+}
+
+double AsteroidRow::getDiameter() const {
+    return table->minDiameterKm()[index];
+}
+
+double AsteroidRow::getMinDiameterKm() const {
+    return table->minDiameterKm()[index];
+}
+
+double AsteroidRow::getMaxDiameterKm() const {
+    return table->maxDiameterKm()[index];
+}
+
+double AsteroidRow::getAbsoluteMagnitude() const {
+    return table->absoluteMagnitude()[index];
+}
+
+CloseApproachList AsteroidRow::getCloseApproachData() const {
+    CloseApproachList approaches;
+    for (size_t i = table->approachBegin()[index]; i < table->approachBegin()[index + 1]; i++) {
+        approaches.push_back({table->approachDates()[i], table->approachVelocityKmPerS()[i],
+                              table->approachMissDistanceKm()[i], table->approachEpochMs()[i],
+                              table->approachReportedMissDistanceKm()[i]});
+    }
+    return approaches;
+}
+
+size_t AsteroidRow::getCloseApproachCount() const {
+    return table->approachBegin()[index + 1] - table->approachBegin()[index];
+}
+
+double AsteroidRow::getRelativeVelocityKmPerS() const {
+    return table->firstVelocityKmPerS(index);
+}
+
+double AsteroidRow::getMissDistanceKm() const {
+    return table->firstMissDistanceKm(index);
+}
+
+bool AsteroidRow::isDangerous() const {
+    return table->isHazardous(index);
+}
+
+double AsteroidRow::calculateSurfaceGravity() const {
+    return BodyPhysics::surfaceGravity(getDiameter(), getMass());
+}
+
+double AsteroidRow::calculateEscapeVelocity() const {
+    return BodyPhysics::escapeVelocity(getDiameter(), getMass());
+}
+
+double AsteroidRow::calculateImpactEnergy() const {
+    return BodyPhysics::impactEnergy(getMass(), getRelativeVelocityKmPerS());
+}
+
+// AsteroidTable Implementations
+const string AsteroidTable::jplUrlPrefix = "https://ssd.jpl.nasa.gov/tools/sbdb_lookup.html#/?sstr=";
+
+AsteroidTable::AsteroidTable() : approachOffsets(1, 0) {}
+
+string AsteroidTable::id(size_t index) const {
+    uint64_t value = idColumn[index];
+    if (value & textIdFlag) {
+        return string(strings.view(textIds[value & ~textIdFlag]));
+    }
+    return to_string(value);
+}
+
+bool AsteroidTable::numericId(size_t index, uint64_t& id) const {
+    if (idColumn[index] & textIdFlag) return false;
+    id = idColumn[index];
+    return true;
+}
+
+string AsteroidTable::nasaJplUrl(size_t index) const {
+    auto overridden = lower_bound(urlOverrides.begin(), urlOverrides.end(), index,
+                                  [](const pair<uint32_t, ArenaRef>& entry, size_t row) { return entry.first < row; });
+    if (overridden != urlOverrides.end() && overridden->first == index) {
+        return string(strings.view(overridden->second));
+    }
+    return jplUrlPrefix + id(index);
+}
+
+bool AsteroidTable::loadFeed(const json& feed, unsigned threadCount) {
+    FeedFields fields;
+    if (!extract_feed_fields(feed, fields, threadCount)) {
+        return false;
+    }
+    size_t approaches = 0;
+    size_t nameBytes = 0;
+    for (const auto& row : fields.rows) {
+        approaches += row.closeApproaches.size();
+        nameBytes += row.name.size();
+    }
+    reserve(size() + fields.rows.size(), velocities.size() + approaches);
+    strings.reserve(strings.size() + nameBytes);
+    for (const auto& row : fields.rows) {
+        append(row);
+    }
+    return true;
+}
+
+void AsteroidTable::append(const NeoFields& fields) {
+    appendRow(fields.id, fields.name, fields.nasaJplUrl, fields.minDiameterKm, fields.maxDiameterKm,
+              BodyPhysics::asteroidMass(fields.minDiameterKm, fields.maxDiameterKm), fields.absoluteMagnitude,
+              fields.potentiallyHazardous);
+    for (const auto& approach : fields.closeApproaches) {
+        approachDateColumn.push_back(approach.date);
+        epochs.push_back(approach.epochMs);
+        velocities.push_back(approach.relative_velocity);
+        missDistances.push_back(BodyPhysics::effectiveMissDistance(approach.miss_distance));
+        reportedMissDistances.push_back(approach.miss_distance);
+    }
+    approachOffsets.push_back(static_cast<uint32_t>(velocities.size()));
+}
+
+void AsteroidTable::append(const Asteroid& asteroid) {
+    appendRow(asteroid.getID(), asteroid.getName(), asteroid.getNasaJplUrl(), asteroid.getMinDiameterKm(),
+              asteroid.getMaxDiameterKm(), asteroid.getMass(), asteroid.getAbsoluteMagnitude(),
+              asteroid.isDangerous());
+    for (const auto& approach : asteroid.getCloseApproachData()) {
+        approachDateColumn.push_back(approach.date);
+        epochs.push_back(approach.epochMs);
+        velocities.push_back(approach.relative_velocity);
+        missDistances.push_back(approach.miss_distance); // Already adjusted by the constructor
+        reportedMissDistances.push_back(approach.reported_miss_distance);
+    }
+    approachOffsets.push_back(static_cast<uint32_t>(velocities.size()));
+}
+
+void AsteroidTable::appendRow(string_view id, string_view name, string_view url, double minDiameterKm,
+                              double maxDiameterKm, double mass, double magnitude, bool hazardous) {
+    size_t row = masses.size();
+    uint64_t numeric;
+    if (parse_numeric_id(id, numeric)) {
+        idColumn.push_back(numeric);
+    } else {
+        idColumn.push_back(textIdFlag | textIds.size());
+        textIds.push_back(strings.add(id));
+    }
+    nameColumn.push_back(strings.add(name));
+    if (url.size() != jplUrlPrefix.size() + id.size() || url.compare(0, jplUrlPrefix.size(), jplUrlPrefix) != 0 ||
+        url.compare(jplUrlPrefix.size(), string::npos, id) != 0) {
+        urlOverrides.emplace_back(static_cast<uint32_t>(row), strings.add(url));
+    }
+    masses.push_back(mass);
+    minDiameters.push_back(minDiameterKm);
+    maxDiameters.push_back(maxDiameterKm);
+    magnitudes.push_back(magnitude);
+    if (row % 64 == 0) hazardBits.push_back(0);
+    if (hazardous) hazardBits.back() |= uint64_t(1) << (row % 64);
+}
+
+void AsteroidTable::clear() {
+    strings.clear();
+    idColumn.clear();
+    textIds.clear();
+    nameColumn.clear();
+    urlOverrides.clear();
+    masses.clear();
+    minDiameters.clear();
+    maxDiameters.clear();
+    magnitudes.clear();
+    hazardBits.clear();
+    approachOffsets.assign(1, 0);
+    approachDateColumn.clear();
+    epochs.clear();
+    velocities.clear();
+    missDistances.clear();
+    reportedMissDistances.clear();
+}
+
+void AsteroidTable::reserve(size_t rows, size_t approaches) {
+    idColumn.reserve(rows);
+    nameColumn.reserve(rows);
+    masses.reserve(rows);
+    minDiameters.reserve(rows);
+    maxDiameters.reserve(rows);
+    magnitudes.reserve(rows);
+    hazardBits.reserve((rows + 63) / 64);
+    approachOffsets.reserve(rows + 1);
+    approachDateColumn.reserve(approaches);
+    epochs.reserve(approaches);
+    velocities.reserve(approaches);
+    missDistances.reserve(approaches);
+    reportedMissDistances.reserve(approaches);
+}
+
+size_t AsteroidTable::memoryUsage() const {
+    return strings.memoryUsage() + idColumn.capacity() * sizeof(uint64_t) + textIds.capacity() * sizeof(ArenaRef) +
+           nameColumn.capacity() * sizeof(ArenaRef) + urlOverrides.capacity() * sizeof(urlOverrides[0]) +
+           (masses.capacity() + minDiameters.capacity() + maxDiameters.capacity() + magnitudes.capacity()) * sizeof(double) +
+           hazardBits.capacity() * sizeof(uint64_t) + approachOffsets.capacity() * sizeof(uint32_t) +
+           approachDateColumn.capacity() * sizeof(NeoDate) + epochs.capacity() * sizeof(int64_t) +
+           (velocities.capacity() + missDistances.capacity() + reportedMissDistances.capacity()) * sizeof(double);
+}
+
+double AsteroidTable::firstVelocityKmPerS(size_t index) const {
+    return approachOffsets[index] < approachOffsets[index + 1] ? velocities[approachOffsets[index]] : 0.0;
+}
+
+double AsteroidTable::firstMissDistanceKm(size_t index) const {
+    return approachOffsets[index] < approachOffsets[index + 1] ? missDistances[approachOffsets[index]] : 0.0;
+}
+
+size_t AsteroidTable::countHazardous() const {
+    size_t count = 0;
+    for (uint64_t word : hazardBits) count += bitset<64>(word).count();
+    return count;
+}
+
+double AsteroidTable::totalMass() const {
+    double total = 0;
+    for (double mass : masses) total += mass;
+    return total;
+}
+
+void AsteroidTable::surfaceGravities(vector<double>& out) const {
+    out.resize(size());
+    BodyKernels::surfaceGravities(minDiameters.data(), masses.data(), out.data(), size());
+}
+
+void AsteroidTable::escapeVelocities(vector<double>& out) const {
+    out.resize(size());
+    BodyKernels::escapeVelocities(minDiameters.data(), masses.data(), out.data(), size());
+}
+
+void AsteroidTable::impactEnergies(vector<double>& out) const {
+    out.resize(size());
+    for (size_t i = 0; i < size(); i++) {
+        out[i] = BodyPhysics::impactEnergy(masses[i], firstVelocityKmPerS(i));
+    }
+}
@@ -0,0 +1,140 @@
+// src/asteroid_table.h
+
+#ifndef ASTEROID_TABLE_H
+#define ASTEROID_TABLE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "classes.h"
+#include "string_arena.h"
+
+class AsteroidTable;
+
+// Read-only view of one row of an AsteroidTable, with the getters of Asteroid.
+// Cheap to copy; valid as long as the table is not modified. The name is a
+// view into the table; the id and URL, which the table does not keep as
+// text, are built on each call.
+class AsteroidRow {
+public:
+    AsteroidRow(const AsteroidTable& table, size_t index) : table(&table), index(index) {}
+
+    string getID() const;
+    string_view getName() const;
+    string getNasaJplUrl() const;
+    double getMass() const;
+    double getDiameter() const;
+    double getMinDiameterKm() const;
+    double getMaxDiameterKm() const;
+    double getAbsoluteMagnitude() const;
+    CloseApproachList getCloseApproachData() const;
+    size_t getCloseApproachCount() const;
+    double getRelativeVelocityKmPerS() const;
+    double getMissDistanceKm() const;
+    bool isDangerous() const;
+    double calculateSurfaceGravity() const;
+    double calculateEscapeVelocity() const;
+    double calculateImpactEnergy() const;
+
+private:
+    const AsteroidTable* table;
+    size_t index;
+};
+
+// Asteroids stored column by column (structure of arrays).
+// Each numeric attribute lives in its own contiguous array, so a scan over
+// one of them touches only that attribute. The hazard flags are packed 64
+// to a word. Close approaches of all rows share flattened columns: the
+// approaches of row i are [approachBegin[i], approachBegin[i + 1]).
+// Values match what the Asteroid constructor computes, including the mass
+// and the adjusted miss distance; the reported miss distance is kept
+// alongside it.
+//
+// Strings are not stored as std::string. Numeric ids (all NeoWs ids) are
+// kept as integers, names live in one StringArena, close approach dates are
+// NeoDate day numbers and the NASA JPL URL is rebuilt from the id; only
+// URLs that do not follow that pattern are stored. Loading therefore makes a
+// handful of growing allocations rather than several per row.
+class AsteroidTable {
+public:
+    AsteroidTable();
+
+    // Appends one row per NEO of feed["near_earth_objects"], in feed order.
+    // Dates are extracted in parallel (see extract_feed_fields).
+    bool loadFeed(const json& feed, unsigned threadCount = 0);
+
+    void append(const NeoFields& fields);
+    void append(const Asteroid& asteroid);
+    void clear();
+    void reserve(size_t rows, size_t approaches);
+
+    size_t size() const { return masses.size(); }
+    bool empty() const { return masses.empty(); }
+    AsteroidRow operator[](size_t index) const { return AsteroidRow(*this, index); }
+
+    // Row strings; views are valid until the table is modified
+    string id(size_t index) const;
+    bool numericId(size_t index, uint64_t& id) const; // False if the id is not a plain number
+    string_view name(size_t index) const { return strings.view(nameColumn[index]); }
+    string nasaJplUrl(size_t index) const;
+
+    // Row columns
+    const vector<double>& mass() const { return masses; }
+    const vector<double>& minDiameterKm() const { return minDiameters; }
+    const vector<double>& maxDiameterKm() const { return maxDiameters; }
+    const vector<double>& absoluteMagnitude() const { return magnitudes; }
+    const vector<uint64_t>& hazardBitmap() const { return hazardBits; }
+    bool isHazardous(size_t index) const { return (hazardBits[index / 64] >> (index % 64)) & 1; }
+
+    // Close approach columns, size() + 1 offsets into the approach arrays
+    const vector<uint32_t>& approachBegin() const { return approachOffsets; }
+    const vector<NeoDate>& approachDates() const { return approachDateColumn; }
+    const vector<int64_t>& approachEpochMs() const { return epochs; }
+    const vector<double>& approachVelocityKmPerS() const { return velocities; }
+    const vector<double>& approachMissDistanceKm() const { return missDistances; } // Adjusted, like Asteroid
+    const vector<double>& approachReportedMissDistanceKm() const { return reportedMissDistances; }
+
+    // Bulk computations over the columns, one result per row
+    size_t countHazardous() const;
+    double totalMass() const;
+    void surfaceGravities(vector<double>& out) const;
+    void escapeVelocities(vector<double>& out) const;
+    void impactEnergies(vector<double>& out) const; // At the first close approach, like Asteroid
+
+    // Velocity and miss distance of a row's first close approach, 0 if it has none
+    double firstVelocityKmPerS(size_t index) const;
+    double firstMissDistanceKm(size_t index) const;
+
+    // Heap bytes held by all columns
+    size_t memoryUsage() const;
+
+    // NASA JPL URLs are this prefix followed by the id
+    static const string jplUrlPrefix;
+
+private:
+    // Plain numeric ids; ids with textIdFlag set index textIds instead
+    static const uint64_t textIdFlag = uint64_t(1) << 63;
+
+    StringArena strings;
+    vector<uint64_t> idColumn;
+    vector<ArenaRef> textIds;
+    vector<ArenaRef> nameColumn;
+    vector<pair<uint32_t, ArenaRef>> urlOverrides; // By row, for URLs that are not prefix + id
+    vector<double> masses;
+    vector<double> minDiameters;
+    vector<double> maxDiameters;
+    vector<double> magnitudes;
+    vector<uint64_t> hazardBits;
+
+    vector<uint32_t> approachOffsets;
+    vector<NeoDate> approachDateColumn;
+    vector<int64_t> epochs;
+    vector<double> velocities;
+    vector<double> missDistances;
+    vector<double> reportedMissDistances;
+
+    void appendRow(string_view id, string_view name, string_view url, double minDiameterKm,
+                   double maxDiameterKm, double mass, double magnitude, bool hazardous);
+};
+
+#endif // ASTEROID_TABLE_H
@@ -0,0 +1,231 @@
+// src/body_kernels.cpp
+
+#include "body_kernels.h"
+#include "body_physics.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BODY_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define BODY_KERNELS_X86 0
+#endif
+
+namespace BodyKernels {
+namespace {
+
+using BodyPhysics::G;
+
+// Constants shared by every path, folded exactly as in BodyPhysics
+const double sphereVolume = (4.0 / 3.0) * M_PI;
+const double twoG = 2 * G;
+
+struct KernelTable {
+    void (*masses)(const double*, const double*, double*, size_t);
+    void (*gravities)(const double*, const double*, double*, size_t);
+    void (*escapes)(const double*, const double*, double*, size_t);
+    void (*energies)(const double*, const double*, double*, size_t);
+};
+
+// Scalar reference: the BodyPhysics functions themselves
+void massesScalar(const double* minDiameterKm, const double* maxDiameterKm, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) out[i] = BodyPhysics::asteroidMass(minDiameterKm[i], maxDiameterKm[i]);
+}
+
+void gravitiesScalar(const double* diameterKm, const double* massKg, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) out[i] = BodyPhysics::surfaceGravity(diameterKm[i], massKg[i]);
+}
+
+void escapesScalar(const double* diameterKm, const double* massKg, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) out[i] = BodyPhysics::escapeVelocity(diameterKm[i], massKg[i]);
+}
+
+void energiesScalar(const double* massKg, const double* velocityKmPerS, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) out[i] = BodyPhysics::impactEnergy(massKg[i], velocityKmPerS[i]);
+}
+
+const KernelTable scalarKernels = {massesScalar, gravitiesScalar, escapesScalar, energiesScalar};
+
+#if BODY_KERNELS_X86
+
+// The vector paths perform the operations of the scalar formulas in the same
+// order, with no fused multiply-add, so the results round identically; only
+// pow(r, 3) becomes r * r * r. The last partial vector is handled with masked
+// loads and stores rather than a scalar tail, so every element of a column
+// goes through the same arithmetic.
+
+// AVX2: 4 doubles per step
+__attribute__((target("avx2"))) inline __m256i tailMask(size_t remaining) {
+    return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(remaining)), _mm256_setr_epi64x(0, 1, 2, 3));
+}
+
+__attribute__((target("avx2"))) inline __m256d radiusMeters(__m256d diameterKm) {
+    return _mm256_div_pd(_mm256_mul_pd(diameterKm, _mm256_set1_pd(1000.0)), _mm256_set1_pd(2.0));
+}
+
+__attribute__((target("avx2"))) inline __m256d massAvx2(__m256d minDiameterKm, __m256d maxDiameterKm) {
+    __m256d radiusMin = radiusMeters(minDiameterKm);
+    __m256d radiusMax = radiusMeters(maxDiameterKm);
+    __m256d volume = _mm256_set1_pd(sphereVolume);
+    __m256d volumeMin = _mm256_mul_pd(volume, _mm256_mul_pd(_mm256_mul_pd(radiusMin, radiusMin), radiusMin));
+    __m256d volumeMax = _mm256_mul_pd(volume, _mm256_mul_pd(_mm256_mul_pd(radiusMax, radiusMax), radiusMax));
+    __m256d average = _mm256_div_pd(_mm256_add_pd(volumeMin, volumeMax), _mm256_set1_pd(2.0));
+    return _mm256_mul_pd(_mm256_set1_pd(BodyPhysics::asteroidDensity), average);
+}
+
+__attribute__((target("avx2"))) inline __m256d gravityAvx2(__m256d diameterKm, __m256d massKg) {
+    __m256d radius = radiusMeters(diameterKm);
+    return _mm256_div_pd(_mm256_mul_pd(_mm256_set1_pd(G), massKg), _mm256_mul_pd(radius, radius));
+}
+
+__attribute__((target("avx2"))) inline __m256d escapeAvx2(__m256d diameterKm, __m256d massKg) {
+    __m256d squared = _mm256_div_pd(_mm256_mul_pd(_mm256_set1_pd(twoG), massKg), radiusMeters(diameterKm));
+    return _mm256_div_pd(_mm256_sqrt_pd(squared), _mm256_set1_pd(1000.0));
+}
+
+__attribute__((target("avx2"))) inline __m256d energyAvx2(__m256d massKg, __m256d velocityKmPerS) {
+    __m256d velocity = _mm256_mul_pd(velocityKmPerS, _mm256_set1_pd(1000.0));
+    __m256d joules = _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), massKg), _mm256_mul_pd(velocity, velocity));
+    return _mm256_div_pd(joules, _mm256_set1_pd(BodyPhysics::joulesPerMegaton));
+}
+
+// Runs formula over two input columns
+template <__m256d (*formula)(__m256d, __m256d)>
+__attribute__((target("avx2"))) void mapAvx2(const double* a, const double* b, double* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm256_storeu_pd(out + i, formula(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    if (i < count) {
+        __m256i mask = tailMask(count - i);
+        __m256d result = formula(_mm256_maskload_pd(a + i, mask), _mm256_maskload_pd(b + i, mask));
+        _mm256_maskstore_pd(out + i, mask, result);
+    }
+}
+
+const KernelTable avx2Kernels = {mapAvx2<massAvx2>, mapAvx2<gravityAvx2>, mapAvx2<escapeAvx2>, mapAvx2<energyAvx2>};
+
+// AVX-512: 8 doubles per step
+__attribute__((target("avx512f"))) inline __m512d radiusMeters(__m512d diameterKm) {
+    return _mm512_div_pd(_mm512_mul_pd(diameterKm, _mm512_set1_pd(1000.0)), _mm512_set1_pd(2.0));
+}
+
+__attribute__((target("avx512f"))) inline __m512d massAvx512(__m512d minDiameterKm, __m512d maxDiameterKm) {
+    __m512d radiusMin = radiusMeters(minDiameterKm);
+    __m512d radiusMax = radiusMeters(maxDiameterKm);
+    __m512d volume = _mm512_set1_pd(sphereVolume);
+    __m512d volumeMin = _mm512_mul_pd(volume, _mm512_mul_pd(_mm512_mul_pd(radiusMin, radiusMin), radiusMin));
+    __m512d volumeMax = _mm512_mul_pd(volume, _mm512_mul_pd(_mm512_mul_pd(radiusMax, radiusMax), radiusMax));
+    __m512d average = _mm512_div_pd(_mm512_add_pd(volumeMin, volumeMax), _mm512_set1_pd(2.0));
+    return _mm512_mul_pd(_mm512_set1_pd(BodyPhysics::asteroidDensity), average);
+}
+
+__attribute__((target("avx512f"))) inline __m512d gravityAvx512(__m512d diameterKm, __m512d massKg) {
+    __m512d radius = radiusMeters(diameterKm);
+    return _mm512_div_pd(_mm512_mul_pd(_mm512_set1_pd(G), massKg), _mm512_mul_pd(radius, radius));
+}
+
+__attribute__((target("avx512f"))) inline __m512d escapeAvx512(__m512d diameterKm, __m512d massKg) {
+    __m512d squared = _mm512_div_pd(_mm512_mul_pd(_mm512_set1_pd(twoG), massKg), radiusMeters(diameterKm));
+    // The masked form of sqrt, as GCC warns about the undefined source the plain one passes
+    __m512d root = _mm512_mask_sqrt_pd(squared, static_cast<__mmask8>(0xFF), squared);
+    return _mm512_div_pd(root, _mm512_set1_pd(1000.0));
+}
+
+__attribute__((target("avx512f"))) inline __m512d energyAvx512(__m512d massKg, __m512d velocityKmPerS) {
+    __m512d velocity = _mm512_mul_pd(velocityKmPerS, _mm512_set1_pd(1000.0));
+    __m512d joules = _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(0.5), massKg), _mm512_mul_pd(velocity, velocity));
+    return _mm512_div_pd(joules, _mm512_set1_pd(BodyPhysics::joulesPerMegaton));
+}
+
+template <__m512d (*formula)(__m512d, __m512d)>
+__attribute__((target("avx512f"))) void mapAvx512(const double* a, const double* b, double* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm512_storeu_pd(out + i, formula(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    if (i < count) {
+        __mmask8 mask = static_cast<__mmask8>((1u << (count - i)) - 1);
+        __m512d result = formula(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i));
+        _mm512_mask_storeu_pd(out + i, mask, result);
+    }
+}
+
+const KernelTable avx512Kernels = {mapAvx512<massAvx512>, mapAvx512<gravityAvx512>, mapAvx512<escapeAvx512>,
+                                   mapAvx512<energyAvx512>};
+
+#endif // BODY_KERNELS_X86
+
+const KernelTable& kernelsFor(Level level) {
+#if BODY_KERNELS_X86
+    if (level == Level::Avx512) return avx512Kernels;
+    if (level == Level::Avx2) return avx2Kernels;
+#endif
+    (void)level;
+    return scalarKernels;
+}
+
+Level detectLevel() {
+#if BODY_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return Level::Avx512;
+    if (__builtin_cpu_supports("avx2")) return Level::Avx2;
+#endif
+    return Level::Scalar;
+}
+
+std::atomic<Level>& active() {
+    static std::atomic<Level> level(supportedLevel());
+    return level;
+}
+
+const KernelTable& current() {
+    return kernelsFor(active().load(std::memory_order_relaxed));
+}
+
+} // namespace
+
+Level supportedLevel() {
+    static const Level level = detectLevel();
+    return level;
+}
+
+Level activeLevel() {
+    return active().load(std::memory_order_relaxed);
+}
+
+bool setLevel(Level level) {
+    if (level > supportedLevel()) {
+        return false;
+    }
+    active().store(level, std::memory_order_relaxed);
+    return true;
+}
+
+const char* levelName(Level level) {
+    switch (level) {
+        case Level::Scalar: return "scalar";
+        case Level::Avx2: return "AVX2";
+        case Level::Avx512: return "AVX-512";
+    }
+    return "unknown";
+}
+
+void asteroidMasses(const double* minDiameterKm, const double* maxDiameterKm, double* out, size_t count) {
+    current().masses(minDiameterKm, maxDiameterKm, out, count);
+}
+
+void surfaceGravities(const double* diameterKm, const double* massKg, double* out, size_t count) {
+    current().gravities(diameterKm, massKg, out, count);
+}
+
+void escapeVelocities(const double* diameterKm, const double* massKg, double* out, size_t count) {
+    current().escapes(diameterKm, massKg, out, count);
+}
+
+void impactEnergies(const double* massKg, const double* velocityKmPerS, double* out, size_t count) {
+    current().energies(massKg, velocityKmPerS, out, count);
+}
+
+} // namespace BodyKernels
@@ -0,0 +1,47 @@
+// src/body_kernels.h
+
+#ifndef BODY_KERNELS_H
+#define BODY_KERNELS_H
+
+#include <cstddef>
+
+// Batch versions of the BodyPhysics formulas over whole columns, such as
+// those of AsteroidTable. Each kernel reads `count` values from every input
+// column and writes `count` results; out may alias an input.
+// The widest instruction set the CPU supports is picked at run time:
+// AVX-512, AVX2, or a scalar loop over the BodyPhysics functions.
+// Results of the vector paths against that scalar reference:
+//   surfaceGravities, escapeVelocities   identical
+//   impactEnergies                       identical
+//   asteroidMasses                       within 4 ULP (r * r * r instead of pow(r, 3))
+namespace BodyKernels {
+
+enum class Level { Scalar, Avx2, Avx512 };
+
+// Widest level this CPU runs
+Level supportedLevel();
+
+// Level the kernels currently use, supportedLevel() unless changed
+Level activeLevel();
+
+// Makes the kernels use level, as tests and benchmarks do to compare paths.
+// Returns false, changing nothing, if the CPU cannot run it.
+bool setLevel(Level level);
+
+const char* levelName(Level level);
+
+// kg, from the two diameter estimates in km (BodyPhysics::asteroidMass)
+void asteroidMasses(const double* minDiameterKm, const double* maxDiameterKm, double* out, size_t count);
+
+// m/s^2 (BodyPhysics::surfaceGravity)
+void surfaceGravities(const double* diameterKm, const double* massKg, double* out, size_t count);
+
+// km/s (BodyPhysics::escapeVelocity)
+void escapeVelocities(const double* diameterKm, const double* massKg, double* out, size_t count);
+
+// Megatons of TNT (BodyPhysics::impactEnergy)
+void impactEnergies(const double* massKg, const double* velocityKmPerS, double* out, size_t count);
+
+} // namespace BodyKernels
+
+#endif // BODY_KERNELS_H
@@ -0,0 +1,86 @@
+// src/body_physics.h
+
+#ifndef BODY_PHYSICS_H
+#define BODY_PHYSICS_H
+
+#include <algorithm>
+#include <cmath>
+
+// Formulas behind SpaceBody and Asteroid, as free functions so that bulk
+// code working on plain columns gets exactly the same results
+namespace BodyPhysics {
+
+constexpr double G = 6.67430e-11;              // m^3 kg^-1 s^-2
+constexpr double asteroidDensity = 3000.0;     // kg/m^3
+constexpr double joulesPerMegaton = 4.184e15;  // TNT equivalent
+constexpr double earthRadiusKm = 6371.0;
+constexpr double kmPerAu = 149597870.7;        // Astronomical unit
+
+// m/s^2
+constexpr double surfaceGravity(double diameterKm, double massKg) {
+    double radius_m = (diameterKm * 1000) / 2.0;
+    return (G * massKg) / (radius_m * radius_m);
+}
+
+// (m/s)^2, the escape velocity before its square root
+constexpr double escapeVelocitySquared(double diameterKm, double massKg) {
+    double radiusMeters = (diameterKm * 1000) / 2.0;
+    return (2 * G * massKg) / radiusMeters;
+}
+
+// km/s
+inline double escapeVelocity(double diameterKm, double massKg) {
+    double escapeVelocity_m_s = std::sqrt(escapeVelocitySquared(diameterKm, massKg));
+    return escapeVelocity_m_s / 1000.0;
+}
+
+// Square root for constant expressions, where std::sqrt is not allowed in
+// C++17. Newton's method from above, stopping once the estimate no longer
+// decreases; agrees with std::sqrt to within 1 ULP.
+constexpr double compileTimeSqrt(double x) {
+    if (!(x > 0)) {
+        return 0.0;
+    }
+    double root = x > 1 ? x : 1;
+    while (true) {
+        double next = 0.5 * (root + x / root);
+        if (!(next < root)) {
+            return root;
+        }
+        root = next;
+    }
+}
+
+// km/s, escapeVelocity for constant expressions
+constexpr double compileTimeEscapeVelocity(double diameterKm, double massKg) {
+    return compileTimeSqrt(escapeVelocitySquared(diameterKm, massKg)) / 1000.0;
+}
+
+// Megatons of TNT
+inline double impactEnergy(double massKg, double velocityKmPerS) {
+    double velocity_m_s = velocityKmPerS * 1000.0;
+    double energy_joules = 0.5 * massKg * std::pow(velocity_m_s, 2);
+    return energy_joules / joulesPerMegaton;
+}
+
+// Mass of a rocky body, averaging the volumes of the two diameter estimates
+inline double asteroidMass(double minDiameterKm, double maxDiameterKm) {
+    double radiusMin = minDiameterKm * 1000.0 / 2.0;
+    double radiusMax = maxDiameterKm * 1000.0 / 2.0;
+
+    double volumeMin = (4.0 / 3.0) * M_PI * std::pow(radiusMin, 3);
+    double volumeMax = (4.0 / 3.0) * M_PI * std::pow(radiusMax, 3);
+
+    double avgVolume = (volumeMin + volumeMax) / 2.0;
+    return asteroidDensity * avgVolume;
+}
+
+// Miss distance an Asteroid keeps for a reported one: half of it, but never
+// closer than two Earth radii
+inline double effectiveMissDistance(double reportedKm) {
+    return std::max(reportedKm / 2.0, earthRadiusKm * 2);
+}
+
+} // namespace BodyPhysics
+
+#endif // BODY_PHYSICS_H
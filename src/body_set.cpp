@@ -0,0 +1,40 @@
+// src/body_set.cpp
+
+#include "body_set.h"
+#include "planets.h"
+
+void BodySet::addSolarSystem() {
+    for (const auto& planet : SolarSystem::predefinedPlanets) {
+        add(Planet(planet.name, planet.diameter, planet.mass));
+    }
+}
+
+void BodySet::surfaceGravities(vector<double>& out) const {
+    out.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        out[i] = base(bodies[i]).calculateSurfaceGravity();
+    }
+}
+
+void BodySet::escapeVelocities(vector<double>& out) const {
+    out.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        out[i] = base(bodies[i]).calculateEscapeVelocity();
+    }
+}
+
+double BodySet::totalMass() const {
+    double total = 0;
+    for (const auto& body : bodies) total += base(body).getMass();
+    return total;
+}
+
+size_t BodySet::countAsteroids() const {
+    size_t count = 0;
+    for (const auto& body : bodies) count += holds_alternative<Asteroid>(body);
+    return count;
+}
+
+void BodySet::printInfo() const {
+    forEach([](const auto& body) { body.printInfo(); });
+}
@@ -0,0 +1,57 @@
+// src/body_set.h
+
+#ifndef BODY_SET_H
+#define BODY_SET_H
+
+#include <variant>
+#include <vector>
+#include "classes.h"
+
+// A planet or an asteroid, held by value
+using Body = variant<Planet, Asteroid>;
+
+// Mixed planets and asteroids stored contiguously as Body variants.
+// Each element carries its kind in the variant index, so a loop over the set
+// branches on that index instead of loading a vtable through a pointer, and
+// the bodies sit next to each other rather than in separate heap blocks.
+// Planet and Asteroid are final, so every member call made through visit()
+// is a direct call, including printInfo and the destructors.
+class BodySet {
+public:
+    void add(Planet planet) { bodies.emplace_back(std::move(planet)); }
+    void add(Asteroid asteroid) { bodies.emplace_back(std::move(asteroid)); }
+
+    // Adds the planets of SolarSystem::predefinedPlanets
+    void addSolarSystem();
+
+    void reserve(size_t count) { bodies.reserve(count); }
+    void clear() { bodies.clear(); }
+    size_t size() const { return bodies.size(); }
+    bool empty() const { return bodies.empty(); }
+    const Body& operator[](size_t index) const { return bodies[index]; }
+    const vector<Body>& all() const { return bodies; }
+
+    // Calls f(const Planet&) or f(const Asteroid&) for every body, in order
+    template <typename Function>
+    void forEach(Function&& f) const {
+        for (const auto& body : bodies) visit(f, body);
+    }
+
+    // The base of any body, for the attributes they share
+    static const SpaceBody& base(const Body& body) {
+        return visit([](const auto& concrete) -> const SpaceBody& { return concrete; }, body);
+    }
+
+    // Batch computations, one result per body
+    void surfaceGravities(vector<double>& out) const;
+    void escapeVelocities(vector<double>& out) const;
+    double totalMass() const;
+    size_t countAsteroids() const;
+
+    void printInfo() const;
+
+private:
+    vector<Body> bodies;
+};
+
+#endif // BODY_SET_H
@@ -1,10 +1,12 @@
 // src/classes.cpp
 
 #include "classes.h"
+#include "body_physics.h"
+#include "lifecycle_trace.h"
 
 // SpaceBody Implementations
-SpaceBody::SpaceBody(const string& name, double diameter, double mass)
-    : name(name), diameter(diameter), mass(mass)
+SpaceBody::SpaceBody(string_view name, double diameter, double mass, pmr::memory_resource* memory)
+    : name(name, memory), diameter(diameter), mass(mass)
 {
     if (diameter <= 0) {
         throw std::invalid_argument("Diameter must be positive.");
@@ -12,6 +14,8 @@ SpaceBody::SpaceBody(const string& name, double diameter, double mass)
     if (mass <= 0) {
         throw std::invalid_argument("Mass must be positive.");
     }
+    updateDerived();
+    TRACE_LIFECYCLE(TraceLevel::Verbose, TraceBody::SpaceBody, TraceEvent::Constructed, name);
 }
 
 void SpaceBody::printInfo() const {
@@ -19,16 +23,16 @@ void SpaceBody::printInfo() const {
 }
 
 double SpaceBody::calculateSurfaceGravity() const {
-    const double G = 6.67430e-11; // m^3 kg^-1 s^-2
-    double radius_m = (diameter * 1000) / 2.0;
-    return (G * mass) / (radius_m * radius_m); // m/s^2
+    return surfaceGravity; // m/s^2
 }
 
 double SpaceBody::calculateEscapeVelocity() const {
-    const double G = 6.67430e-11; // m^3 kg^-1 s^-2
-    double radiusMeters = (diameter * 1000) / 2.0;
-    double escapeVelocity_m_s = sqrt((2 * G * mass) / radiusMeters);
-    return escapeVelocity_m_s / 1000.0; // km/s
+    return escapeVelocity; // km/s
+}
+
+void SpaceBody::updateDerived() {
+    surfaceGravity = BodyPhysics::surfaceGravity(diameter, mass);
+    escapeVelocity = BodyPhysics::escapeVelocity(diameter, mass);
 }
 
 double SpaceBody::getMass() const {
@@ -39,27 +43,36 @@ double SpaceBody::getDiameter() const {
     return diameter;
 }
 
-string SpaceBody::getName() const {
+string_view SpaceBody::getName() const {
     return name;
 }
 
 SpaceBody::~SpaceBody() {
-    cout << "Space body " << name << " memory freed." << endl;
+    TRACE_LIFECYCLE(TraceLevel::Lifecycle, TraceBody::SpaceBody, TraceEvent::Destroyed, name);
 }
 
 // Planet Implementations
-Planet::Planet(const string& name, double diameter, double mass)
-    : SpaceBody(name, diameter, mass) {}
+Planet::Planet(string_view name, double diameter, double mass)
+    : SpaceBody(name, diameter, mass)
+{
+    TRACE_LIFECYCLE(TraceLevel::Verbose, TraceBody::Planet, TraceEvent::Constructed, name);
+}
 
 void Planet::printInfo() const {
-    cout << "Planet Name: " << name << ", Mass: " << mass << " kg, Diameter: " << diameter << " km" << endl;
-    cout << "Surface Gravity: " << calculateSurfaceGravity() << " m/s^2" << endl;
-    cout << "Escape Velocity: " << calculateEscapeVelocity() << " km/s" << endl;
+    printPlanetData({name, diameter, mass, calculateSurfaceGravity(), calculateEscapeVelocity()});
+}
+
+void printPlanetData(const PlanetData& planet) {
+    cout << "Planet Name: " << planet.name << ", Mass: " << planet.mass << " kg, Diameter: " << planet.diameter
+         << " km" << endl;
+    cout << "Surface Gravity: " << planet.surfaceGravity << " m/s^2" << endl;
+    cout << "Escape Velocity: " << planet.escapeVelocity << " km/s" << endl;
 }
 
 void Planet::handleImpact(const Asteroid& asteroid) {
     // Example: Reduce planet's mass by asteroid's mass
     mass -= asteroid.getMass();
+    updateDerived();
 
     // Additional logic can be implemented here
     // For example, logging the impact, updating other attributes, etc.
@@ -68,37 +81,40 @@ void Planet::handleImpact(const Asteroid& asteroid) {
 }
 
 Planet::~Planet() {
-    cout << "Planet " << name << " memory freed." << endl;
+    TRACE_LIFECYCLE(TraceLevel::Lifecycle, TraceBody::Planet, TraceEvent::Destroyed, name);
 }
 
 // Asteroid Implementations
+namespace {
+
+NeoFields extractFields(const json& asteroidData) {
+    NeoFields fields;
+    extract_neo_fields(asteroidData, fields);
+    return fields;
+}
+
+} // namespace
+
 Asteroid::Asteroid(const json& asteroidData)
-    : SpaceBody(
-        asteroidData.at("name").get<string>(),
-        asteroidData.at("estimated_diameter").at("kilometers").at("estimated_diameter_min").get<double>(),
-        calculateMass(asteroidData)
-      ),
-      id(asteroidData.at("id").get<string>()),
-      nasa_jpl_url(asteroidData.at("nasa_jpl_url").get<string>()),
-      absolute_magnitude(asteroidData.at("absolute_magnitude_h").get<double>()),
-      isDangerous(asteroidData.at("is_potentially_hazardous_asteroid").get<bool>())
+    : Asteroid(extractFields(asteroidData)) {}
+
+Asteroid::Asteroid(NeoFields fields, pmr::memory_resource* memory)
+    : SpaceBody(fields.name, fields.minDiameterKm, calculateMass(fields.minDiameterKm, fields.maxDiameterKm), memory),
+      id(fields.id, memory),
+      nasa_jpl_url(fields.nasaJplUrl, memory),
+      absolute_magnitude(fields.absoluteMagnitude),
+      minDiameterKm(fields.minDiameterKm),
+      maxDiameterKm(fields.maxDiameterKm),
+      potentiallyHazardous(fields.potentiallyHazardous),
+      closeApproachDataList(memory)
 {
-    auto diameter = asteroidData.at("estimated_diameter").at("kilometers");
-    minDiameterKm = diameter.at("estimated_diameter_min").get<double>();
-    maxDiameterKm = diameter.at("estimated_diameter_max").get<double>();
-
-    auto close_approaches = asteroidData.at("close_approach_data");
-    for (const auto& approach : close_approaches) {
-        CloseApproachData data;
-        data.date = approach.at("close_approach_date").get<string>();
-        data.relative_velocity = stod(approach.at("relative_velocity").at("kilometers_per_second").get<string>());
-        data.miss_distance = stod(approach.at("miss_distance").at("kilometers").get<string>());
-        // Adjust miss_distance as per original logic
-        data.miss_distance = max(data.miss_distance / 2.0, 6371.0 * 2); // EARTH_RADIUS is 6371 km
-        closeApproachDataList.push_back(data);
+    closeApproachDataList = std::move(fields.closeApproaches);
+    for (auto& approach : closeApproachDataList) {
+        approach.reported_miss_distance = approach.miss_distance;
+        approach.miss_distance = BodyPhysics::effectiveMissDistance(approach.miss_distance);
     }
-
-    mass = calculateMass(asteroidData);
+    impactEnergy = BodyPhysics::impactEnergy(mass, getRelativeVelocityKmPerS()); // SpaceBody cached the rest
+    TRACE_LIFECYCLE(TraceLevel::Verbose, TraceBody::Asteroid, TraceEvent::Constructed, name);
 }
 
 Asteroid::Asteroid(const Asteroid& other)
@@ -108,10 +124,11 @@ Asteroid::Asteroid(const Asteroid& other)
       absolute_magnitude(other.absolute_magnitude),
       minDiameterKm(other.minDiameterKm),
       maxDiameterKm(other.maxDiameterKm),
-      isDangerous(other.isDangerous),
-      closeApproachDataList(other.closeApproachDataList)
+      potentiallyHazardous(other.potentiallyHazardous),
+      closeApproachDataList(other.closeApproachDataList),
+      impactEnergy(other.impactEnergy)
 {
-    cout << "Asteroid " << name << " copied." << endl;
+    TRACE_LIFECYCLE(TraceLevel::Lifecycle, TraceBody::Asteroid, TraceEvent::Copied, name);
 }
 
 void Asteroid::printInfo() const {
@@ -120,7 +137,7 @@ void Asteroid::printInfo() const {
     cout << "NASA JPL URL: " << nasa_jpl_url << endl;
     cout << "Absolute Magnitude (H): " << absolute_magnitude << endl;
     cout << "Diameter (Min): " << minDiameterKm << " km, Max: " << maxDiameterKm << " km" << endl;
-    cout << "Is Potentially Hazardous: " << (isDangerous ? "Yes" : "No") << endl;
+    cout << "Is Potentially Hazardous: " << (potentiallyHazardous ? "Yes" : "No") << endl;
     for (const auto& approach : closeApproachDataList) {
         cout << "Close Approach Date: " << approach.date << endl;
         cout << "Relative Velocity: " << approach.relative_velocity << " km/s" << endl;
@@ -132,53 +149,57 @@ void Asteroid::printInfo() const {
 }
 
 double Asteroid::calculateImpactEnergy() const {
-    double velocity_m_s = relativeVelocityKmPerS * 1000.0;
-    double energy_joules = 0.5 * mass * pow(velocity_m_s, 2);
-    double energy_megatons = energy_joules / 4.184e15;
-    return energy_megatons;
+    return impactEnergy; // megatons of TNT
 }
 
-Asteroid Asteroid::operator+(const Asteroid& other) const {
-    Asteroid combined(*this); // Use copy constructor
+void Asteroid::updateDerived() {
+    SpaceBody::updateDerived();
+    impactEnergy = BodyPhysics::impactEnergy(mass, getRelativeVelocityKmPerS());
+}
 
-    combined.name = name + " & " + other.name;
-    combined.minDiameterKm += other.minDiameterKm;
-    combined.maxDiameterKm += other.maxDiameterKm;
-    combined.mass += other.mass;
-    combined.relativeVelocityKmPerS += other.relativeVelocityKmPerS;
-    combined.missDistanceKm += other.missDistanceKm;
+Asteroid& Asteroid::operator+=(const Asteroid& other) {
+    name.append(" & ").append(other.name);
+    minDiameterKm += other.minDiameterKm;
+    maxDiameterKm += other.maxDiameterKm;
+    mass += other.mass;
+    if (!closeApproachDataList.empty()) {
+        closeApproachDataList[0].relative_velocity += other.getRelativeVelocityKmPerS();
+        closeApproachDataList[0].miss_distance += other.getMissDistanceKm();
+        if (!other.closeApproachDataList.empty()) {
+            closeApproachDataList[0].reported_miss_distance += other.closeApproachDataList[0].reported_miss_distance;
+        }
+    }
 
-    combined.isDangerous = ((combined.minDiameterKm > 280) || (combined.relativeVelocityKmPerS > 5.0));
-    return combined;
+    potentiallyHazardous = ((minDiameterKm > 280) || (getRelativeVelocityKmPerS() > 5.0));
+    updateDerived();
+    return *this;
 }
 
-Asteroid::~Asteroid() {
-    cout << "Asteroid " << name << " memory freed." << endl;
+Asteroid Asteroid::operator+(const Asteroid& other) const& {
+    Asteroid combined(*this); // Use copy constructor
+    combined += other;
+    return combined;
 }
 
-double Asteroid::calculateMass(const json& asteroidData) {
-    const double density = 3000.0; // kg/m^3
-    double diameterMin_m = asteroidData.at("estimated_diameter").at("kilometers").at("estimated_diameter_min").get<double>() * 1000.0;
-    double diameterMax_m = asteroidData.at("estimated_diameter").at("kilometers").at("estimated_diameter_max").get<double>() * 1000.0;
-
-    double radiusMin = diameterMin_m / 2.0;
-    double radiusMax = diameterMax_m / 2.0;
-
-    double volumeMin = (4.0 / 3.0) * M_PI * pow(radiusMin, 3);
-    double volumeMax = (4.0 / 3.0) * M_PI * pow(radiusMax, 3);
+Asteroid Asteroid::operator+(const Asteroid& other) && {
+    *this += other;
+    return std::move(*this);
+}
 
-    double avgVolume = (volumeMin + volumeMax) / 2.0;
+Asteroid::~Asteroid() {
+    TRACE_LIFECYCLE(TraceLevel::Lifecycle, TraceBody::Asteroid, TraceEvent::Destroyed, name);
+}
 
-    double massCalculated = density * avgVolume;
-    return massCalculated;
+double Asteroid::calculateMass(double minDiameterKm, double maxDiameterKm) {
+    return BodyPhysics::asteroidMass(minDiameterKm, maxDiameterKm);
 }
 
 // Getter Implementations for Asteroid
-string Asteroid::getID() const {
+string_view Asteroid::getID() const {
     return id;
 }
 
-string Asteroid::getNasaJplUrl() const {
+string_view Asteroid::getNasaJplUrl() const {
     return nasa_jpl_url;
 }
 
@@ -186,10 +207,22 @@ double Asteroid::getAbsoluteMagnitude() const {
     return absolute_magnitude;
 }
 
-vector<CloseApproachData> Asteroid::getCloseApproachData() const {
+double Asteroid::getMinDiameterKm() const {
+    return minDiameterKm;
+}
+
+double Asteroid::getMaxDiameterKm() const {
+    return maxDiameterKm;
+}
+
+const CloseApproachList& Asteroid::getCloseApproachData() const {
     return closeApproachDataList;
 }
 
+size_t Asteroid::getCloseApproachCount() const {
+    return closeApproachDataList.size();
+}
+
 double Asteroid::getRelativeVelocityKmPerS() const {
     // Assuming you want the first approach's velocity
     if (!closeApproachDataList.empty()) {
@@ -205,3 +238,7 @@ double Asteroid::getMissDistanceKm() const {
     }
     return 0.0;
 }
+
+bool Asteroid::isDangerous() const {
+    return potentiallyHazardous;
+}
@@ -4,78 +4,128 @@
 #define CLASS_H
 
 #include <iostream>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <cmath>
 #include <cstdlib>
 #include <vector>
 #include "platform_config.h"  // For conditional compilation
 #include "json.hpp"          // Ensure json.hpp is included
+#include "neo_fields.h"
+#include "planets.h"
 
 using namespace std;
 using json = nlohmann::json;
 
-// Struct to represent Close Approach Data
-struct CloseApproachData {
-    string date;
-    double relative_velocity; // in km/s
-    double miss_distance;     // in km
-};
+class Asteroid;
 
 // Base class for Space Bodies (e.g., Planets, Asteroids)
+// Surface gravity and escape velocity are computed once and kept with the
+// body, so asking for them costs a load; any code that changes the mass or
+// diameter must call updateDerived() afterwards.
+// The name is allocated from the given memory_resource, so a body can live
+// entirely in an arena such as the one of AsteroidFeed. Copies go back to
+// the default resource; moves keep the source's.
 class SpaceBody {
 public:
-    SpaceBody(const string& name, double diameter, double mass);
+    SpaceBody(string_view name, double diameter, double mass,
+              pmr::memory_resource* memory = pmr::get_default_resource());
+    SpaceBody(const SpaceBody& other) = default;
+    SpaceBody(SpaceBody&& other) noexcept = default;
+    SpaceBody& operator=(const SpaceBody& other) = default;
+    SpaceBody& operator=(SpaceBody&& other) = default;
     virtual void printInfo() const;
     double calculateSurfaceGravity() const;
     double calculateEscapeVelocity() const;
     double getMass() const;
     double getDiameter() const;
-    string getName() const; // Getter for name
+    string_view getName() const; // Getter for name
     virtual ~SpaceBody();
 
 protected:
-    string name;
+    pmr::string name;
     double diameter;  // in kilometers
     double mass;      // in kilograms
+
+    // Recomputes the cached quantities from diameter and mass
+    void updateDerived();
+
+private:
+    double surfaceGravity;  // m/s^2, cached
+    double escapeVelocity;  // km/s, cached
 };
 
 // Derived class for Planets
-class Planet : public SpaceBody {
+class Planet final : public SpaceBody {
 public:
-    Planet(const string& name, double diameter, double mass);
+    Planet(string_view name, double diameter, double mass);
+    Planet(const Planet& other) = default;
+    Planet(Planet&& other) noexcept = default;
+    Planet& operator=(const Planet& other) = default;
+    Planet& operator=(Planet&& other) = default;
     void printInfo() const override;
     void handleImpact(const Asteroid& asteroid); // New method for handling impacts
     ~Planet();
 };
 
+// Prints a planet's name, mass, diameter, gravity and escape velocity; used
+// by Planet::printInfo and for the entries of SolarSystem::predefinedPlanets
+void printPlanetData(const PlanetData& planet);
+
 // Derived class for Asteroids
-class Asteroid : public SpaceBody {
+// Moves transfer the strings and close approaches without allocating, so
+// vector<Asteroid> growth and returning Asteroids by value stay cheap; the
+// getters return views rather than copies.
+// The impact energy is cached like gravity and escape velocity, and also
+// depends on the first close approach's velocity.
+// Built from NeoFields with a memory_resource, the strings and any close
+// approaches beyond the first are allocated from it. Move assignment
+// between Asteroids on different resources copies instead.
+class Asteroid final : public SpaceBody {
 public:
     Asteroid(const json& asteroidData);
+    explicit Asteroid(NeoFields fields, pmr::memory_resource* memory = pmr::get_default_resource());
     Asteroid(const Asteroid& other);
+    Asteroid(Asteroid&& other) noexcept = default;
+    Asteroid& operator=(const Asteroid& other) = default;
+    Asteroid& operator=(Asteroid&& other) = default;
     void printInfo() const override;
     double calculateImpactEnergy() const;
-    Asteroid operator+(const Asteroid& other) const;
+
+    // Combines other into this asteroid in place (names joined with " & ",
+    // diameters and masses summed, first close approaches added together)
+    Asteroid& operator+=(const Asteroid& other);
+    Asteroid operator+(const Asteroid& other) const&;
+    Asteroid operator+(const Asteroid& other) &&; // Reuses this temporary, as in a + b + c
     ~Asteroid();
 
     // Getter Methods
-    string getID() const;
-    string getNasaJplUrl() const;
+    string_view getID() const;
+    string_view getNasaJplUrl() const;
     double getAbsoluteMagnitude() const;
-    vector<CloseApproachData> getCloseApproachData() const;
+    double getMinDiameterKm() const;
+    double getMaxDiameterKm() const;
+    const CloseApproachList& getCloseApproachData() const;
+    size_t getCloseApproachCount() const;
     double getRelativeVelocityKmPerS() const;
     double getMissDistanceKm() const;
+    bool isDangerous() const;
 
 private:
-    string id;
-    string nasa_jpl_url;
+    pmr::string id;
+    pmr::string nasa_jpl_url;
     double absolute_magnitude;
     double minDiameterKm;
     double maxDiameterKm;
-    bool isDangerous;
-    vector<CloseApproachData> closeApproachDataList; // Store multiple close approaches
+    bool potentiallyHazardous;
+    CloseApproachList closeApproachDataList; // Store multiple close approaches, the first inline
+    double impactEnergy; // megatons of TNT, cached
+
+    // Recomputes every cached quantity, the base class's included
+    void updateDerived();
 
-    static double calculateMass(const json& asteroidData);
+    static double calculateMass(double minDiameterKm, double maxDiameterKm);
 };
 
 #endif
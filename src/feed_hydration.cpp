@@ -0,0 +1,117 @@
+// src/feed_hydration.cpp
+
+#include "feed_hydration.h"
+#include "parallel.h"
+#include <algorithm>
+
+namespace {
+
+// Drops the rows marked as failed, keeping dateBegin in step
+void removeFailedRows(FeedFields& fields, const vector<string>& errors) {
+    size_t kept = 0;
+    for (size_t date = 0; date < fields.dates.size(); date++) {
+        size_t begin = fields.dateBegin[date];
+        size_t end = fields.dateBegin[date + 1];
+        fields.dateBegin[date] = kept;
+        for (size_t row = begin; row < end; row++) {
+            if (!errors[row].empty()) {
+                cerr << "Skipping NEO record for " << fields.dates[date] << ": " << errors[row] << endl;
+                continue;
+            }
+            if (kept != row) fields.rows[kept] = std::move(fields.rows[row]);
+            kept++;
+        }
+    }
+    fields.dateBegin.back() = kept;
+    fields.rows.resize(kept);
+}
+
+} // namespace
+
+// Function to extract every NEO of a feed, one date per task
+bool extract_feed_fields(const json& feed, FeedFields& fields, unsigned threadCount) {
+    fields.dates.clear();
+    fields.dateBegin.clear();
+    auto neoMap = feed.find("near_earth_objects");
+    if (neoMap == feed.end() || !neoMap->is_object()) {
+        cerr << "Feed has no near_earth_objects." << endl;
+        fields.rows.clear();
+        return false;
+    }
+
+    // Lay out every date's rows before any thread starts writing
+    vector<const json*> lists;
+    size_t total = 0;
+    for (auto it = neoMap->begin(); it != neoMap->end(); ++it) {
+        if (!it->is_array()) {
+            cerr << "Skipping date " << it.key() << ": NEO list is not an array" << endl;
+            continue;
+        }
+        fields.dates.push_back(it.key());
+        fields.dateBegin.push_back(total);
+        lists.push_back(&*it);
+        total += it->size();
+    }
+    fields.dateBegin.push_back(total);
+    fields.rows.resize(total);
+
+    vector<string> errors(total);
+    atomic<bool> failed(false);
+    parallel_for(lists.size(), threadCount, [&](size_t date) {
+        const json& list = *lists[date];
+        size_t begin = fields.dateBegin[date];
+        for (size_t i = 0; i < list.size(); i++) {
+            try {
+                extract_neo_fields(list[i], fields.rows[begin + i]);
+            } catch (const exception& e) {
+                errors[begin + i] = e.what();
+                failed = true;
+            }
+        }
+    });
+
+    if (failed) {
+        removeFailedRows(fields, errors);
+    }
+    return true;
+}
+
+AsteroidFeed::AsteroidFeed(pmr::memory_resource* upstream)
+    : arena(upstream), asteroids(&arena) {}
+
+AsteroidFeed::~AsteroidFeed() {
+    clear();
+}
+
+void AsteroidFeed::clear() {
+    dates.clear();
+    dateBegin.clear();
+    // Swapping with an empty vector also hands back the array itself, which
+    // must not outlive the memory that release() gives back
+    pmr::vector<Asteroid>(&arena).swap(asteroids);
+    arena.release();
+}
+
+// Function to build Asteroids for every NEO of a feed
+bool hydrate_feed(const json& feed, AsteroidFeed& table, unsigned threadCount) {
+    FeedFields fields;
+    table.clear();
+    if (!extract_feed_fields(feed, fields, threadCount)) {
+        return false;
+    }
+
+    table.asteroids.reserve(fields.rows.size()); // Exact size, so the array is never regrown in the arena
+    table.dateBegin.assign(1, 0);
+    for (size_t date = 0; date < fields.dates.size(); date++) {
+        for (size_t row = fields.dateBegin[date]; row < fields.dateBegin[date + 1]; row++) {
+            try {
+                table.asteroids.emplace_back(std::move(fields.rows[row]), &table.arena);
+            } catch (const exception& e) {
+                cerr << "Skipping NEO record for " << fields.dates[date] << ": " << e.what() << endl;
+            }
+        }
+        table.dateBegin.push_back(table.asteroids.size());
+    }
+    table.dates = std::move(fields.dates);
+    return true;
+}
@@ -0,0 +1,55 @@
+// src/feed_hydration.h
+
+#ifndef FEED_HYDRATION_H
+#define FEED_HYDRATION_H
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include "classes.h"
+
+// The extracted fields of every NEO in a feed, in one contiguous array.
+// Rows are grouped by date in feed order: the NEOs listed under dates[i]
+// are rows [dateBegin[i], dateBegin[i + 1]). dateBegin has one more entry
+// than dates, so the last date ends at rows.size().
+struct FeedFields {
+    vector<string> dates;
+    vector<size_t> dateBegin;
+    vector<NeoFields> rows;
+};
+
+// Same layout as FeedFields, holding constructed Asteroids.
+// The asteroids array and everything the Asteroids allocate (names, ids,
+// URLs, extra close approaches) come from the feed's own monotonic arena,
+// which takes memory from upstream in a few large blocks and gives it all
+// back in one release() when the feed is cleared, refilled or destroyed.
+// An Asteroid moved out of the feed still points into the arena; copy it
+// to keep it longer than the feed.
+struct AsteroidFeed {
+    explicit AsteroidFeed(pmr::memory_resource* upstream = pmr::get_default_resource());
+    AsteroidFeed(const AsteroidFeed&) = delete;
+    AsteroidFeed& operator=(const AsteroidFeed&) = delete;
+    ~AsteroidFeed();
+
+    // Destroys the asteroids, then releases the arena in one operation
+    void clear();
+
+    vector<string> dates;
+    vector<size_t> dateBegin;
+    pmr::monotonic_buffer_resource arena; // Declared before asteroids, so it outlives them
+    pmr::vector<Asteroid> asteroids;
+};
+
+// Extracts every NEO of feed["near_earth_objects"] in one call.
+// Each date's rows are placed at an offset known up front, so dates are
+// spread over threadCount worker threads (0 means one per hardware
+// thread) that write straight into the shared array.
+// Records that cannot be extracted are reported and skipped.
+// Returns false if the feed has no near_earth_objects map.
+bool extract_feed_fields(const json& feed, FeedFields& fields, unsigned threadCount = 0);
+
+// Same as extract_feed_fields, then builds an Asteroid from every row in
+// the feed's arena, after clearing whatever the feed held before
+bool hydrate_feed(const json& feed, AsteroidFeed& table, unsigned threadCount = 0);
+
+#endif // FEED_HYDRATION_H
@@ -0,0 +1,82 @@
+// src/fetch_session.cpp
+
+#include "fetch_session.h"
+#include <iostream>
+
+FetchSession::FetchSession()
+    : handle(curl_easy_init()), shareHandle(curl_share_init()), status(0) {
+    curl_share_setopt(shareHandle, CURLSHOPT_LOCKFUNC, lockShared);
+    curl_share_setopt(shareHandle, CURLSHOPT_UNLOCKFUNC, unlockShared);
+    curl_share_setopt(shareHandle, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+    if (handle) {
+        configure(handle);
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, forwardChunk);
+    }
+}
+
+FetchSession::~FetchSession() {
+    // Handles using the share must be gone before the share itself
+    if (handle) curl_easy_cleanup(handle);
+    curl_share_cleanup(shareHandle);
+}
+
+void FetchSession::configure(CURL* curl) const {
+    curl_easy_setopt(curl, CURLOPT_SHARE, shareHandle);
+    curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, ""); // Everything this libcurl can decode
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 600L);
+}
+
+bool FetchSession::get(const string& url, string& body) {
+    body.clear();
+    bool ok = stream(url, [&body](const char* data, size_t size) {
+        body.append(data, size);
+        return true;
+    });
+    if (!ok) body.clear();
+    return ok;
+}
+
+bool FetchSession::stream(const string& url, const ChunkHandler& onChunk) {
+    lock_guard<mutex> lock(requestMutex);
+    status = 0;
+    if (!handle) {
+        cerr << "cURL could not be initialized." << endl;
+        return false;
+    }
+
+    curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, &onChunk);
+    CURLcode res = curl_easy_perform(handle);
+    if (res == CURLE_WRITE_ERROR) {
+        return false; // Stopped by the handler
+    }
+    if (res != CURLE_OK) {
+        cerr << "cURL request failed: " << curl_easy_strerror(res) << endl;
+        return false;
+    }
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+    return true;
+}
+
+long FetchSession::lastStatus() const {
+    lock_guard<mutex> lock(requestMutex);
+    return status;
+}
+
+size_t FetchSession::forwardChunk(char* data, size_t size, size_t count, void* handler) {
+    size_t bytes = size * count;
+    const ChunkHandler& onChunk = *static_cast<const ChunkHandler*>(handler);
+    return onChunk(data, bytes) ? bytes : 0;
+}
+
+void FetchSession::lockShared(CURL*, curl_lock_data data, curl_lock_access, void* session) {
+    static_cast<FetchSession*>(session)->shareMutexes[data].lock();
+}
+
+void FetchSession::unlockShared(CURL*, curl_lock_data data, void* session) {
+    static_cast<FetchSession*>(session)->shareMutexes[data].unlock();
+}
@@ -0,0 +1,62 @@
+// src/fetch_session.h
+
+#ifndef FETCH_SESSION_H
+#define FETCH_SESSION_H
+
+#include <curl/curl.h>
+#include <functional>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+// Long-lived HTTP client for the NeoWs API.
+// One curl easy handle is reused for every request, so the keep-alive
+// connection, TLS session and DNS entry survive between calls. A curl share
+// handle holds the DNS and TLS session caches, so other handles set up
+// through configure() reuse them too. The connection cache is not shared:
+// libcurl does not support sharing it between handles that run on different
+// threads, and a multi handle already pools connections for its transfers.
+// Responses are requested with every Accept-Encoding curl supports (gzip,
+// deflate, ...) and decoded transparently.
+//
+// get() and stream() are serialized by a mutex; use one session per thread
+// for parallel downloads. Configured handles may run on any thread, the
+// shared caches are locked.
+class FetchSession {
+public:
+    // Receives the response body piece by piece; returning false aborts the transfer
+    using ChunkHandler = function<bool(const char* data, size_t size)>;
+
+    FetchSession();
+    ~FetchSession();
+    FetchSession(const FetchSession&) = delete;
+    FetchSession& operator=(const FetchSession&) = delete;
+
+    // Downloads url into body. Returns false on transport errors, in which
+    // case body is empty. The HTTP status is available from lastStatus().
+    bool get(const string& url, string& body);
+
+    // Hands the body to onChunk as it arrives instead of collecting it.
+    // Returns false on transport errors or when onChunk stopped the transfer.
+    bool stream(const string& url, const ChunkHandler& onChunk);
+
+    // Points another easy handle at this session's DNS and TLS caches and encodings.
+    // The session must outlive that handle.
+    void configure(CURL* curl) const;
+
+    long lastStatus() const;
+
+private:
+    CURL* handle;
+    CURLSH* shareHandle;
+    long status;
+    mutable mutex requestMutex;
+    mutex shareMutexes[CURL_LOCK_DATA_LAST];
+
+    static size_t forwardChunk(char* data, size_t size, size_t count, void* handler);
+    static void lockShared(CURL* curl, curl_lock_data data, curl_lock_access access, void* session);
+    static void unlockShared(CURL* curl, curl_lock_data data, void* session);
+};
+
+#endif // FETCH_SESSION_H
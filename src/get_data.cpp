@@ -1,11 +1,17 @@
 #include "get_data.h"
+#include "fetch_session.h"
+#include "mapped_file.h"
+#include "neo_dates.h"
+#include "response_cache.h"
 #include <iostream>
 #include <fstream>
 #include <curl/curl.h>
 #include <cstdlib>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 using namespace std;
+using json = nlohmann::json;
 
 // Function to load environment variables from a file
 void loadEnvFile(const string& filename) {
@@ -40,40 +46,194 @@ size_t WriteCallback(void* contents, size_t size, size_t nmemb, string* s) {
 }
 
 // Function to fetch NEO data from NASA API
+// Requests go through one process-wide session, so repeated lookups reuse the
+// connection to api.nasa.gov instead of reconnecting every time.
+// Successful responses are kept in the on-disk cache, so a date that was
+// already fetched is answered without touching the network
 string fetch_neo_data(const string& date, const string& apiKey) {
-    CURL* curl;
-    CURLcode res;
+    static FetchSession session;
+    static ResponseCache cache;
     string neo_data;
+    if (cache.lookup(neoFeedUrl, date, date, neo_data)) {
+        return neo_data;
+    }
+
+    string url = string(neoFeedUrl) + "?start_date=" + date + "&end_date=" + date + "&api_key=" + apiKey;
+    if (!session.get(url, neo_data)) {
+        neo_data = "";  // Return empty string if the request fails
+    } else if (session.lastStatus() == 200) {
+        cache.store(neoFeedUrl, date, date, neo_data);
+    }
+    return neo_data;
+}
+
+namespace {
+
+// One 7-day request of a range fetch
+struct FeedWindow {
+    string startDate;
+    string endDate;
+    string url;
+    string body;
+};
+
+// The multi loop runs on one thread, so every window can use the range's
+// session for its encodings and DNS/TLS caches. Returns false if no handle
+// could be created for the window.
+bool addWindowTransfer(CURLM* multi, const FetchSession& session, vector<FeedWindow>& windows, size_t index) {
+    CURL* curl = curl_easy_init();
+    if (!curl) {
+        cerr << "cURL could not be initialized." << endl;
+        return false;
+    }
+    session.configure(curl);
+    curl_easy_setopt(curl, CURLOPT_URL, windows[index].url.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &windows[index].body);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, reinterpret_cast<char*>(index));
+    curl_multi_add_handle(multi, curl);
+    return true;
+}
 
-    curl = curl_easy_init();
-    if (curl) {
-        string baseUrl = "https://api.nasa.gov/neo/rest/v1/feed";
-        string url = baseUrl + "?start_date=" + date + "&end_date=" + date + "&api_key=" + apiKey;
+// Describes a window in messages. The request URL carries the API key, so it
+// is never printed
+string describeWindow(const FeedWindow& window, const string& baseUrl) {
+    return window.startDate + " to " + window.endDate + " from " + baseUrl;
+}
 
-        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &neo_data);
+// Adds one window's feed to the merged result
+bool mergeWindow(json& result, const FeedWindow& window, const string& baseUrl) {
+    json feed = json::parse(window.body, nullptr, false);
+    if (feed.is_discarded() || !feed.contains("near_earth_objects")) {
+        cerr << "Invalid feed returned for " << describeWindow(window, baseUrl) << endl;
+        return false;
+    }
+    for (auto& entry : feed["near_earth_objects"].items()) {
+        result["near_earth_objects"][entry.key()] = std::move(entry.value());
+    }
+    result["element_count"] = result["element_count"].get<long>() + feed.value("element_count", 0L);
+    return true;
+}
+
+} // namespace
+
+// Function to fetch a range of dates with concurrent requests
+bool fetch_neo_range(json& result, const string& startDate, const string& endDate,
+                     const string& apiKey, const RangeFetchOptions& options) {
+    int64_t firstDay = 0, lastDay = 0;
+    if (!NeoDates::parseDate(startDate, firstDay) || !NeoDates::parseDate(endDate, lastDay) || lastDay < firstDay) {
+        cerr << "Invalid date range: " << startDate << " to " << endDate << endl;
+        return false;
+    }
 
-        res = curl_easy_perform(curl);
+    result = {{"element_count", 0}, {"near_earth_objects", json::object()}};
+    vector<FeedWindow> windows;
+    for (int64_t day = firstDay; day <= lastDay; day += maxFeedWindowDays) {
+        FeedWindow window;
+        window.startDate = NeoDates::formatDate(day);
+        window.endDate = NeoDates::formatDate(min(day + maxFeedWindowDays - 1, lastDay));
+        window.url = options.baseUrl + "?start_date=" + window.startDate +
+                     "&end_date=" + window.endDate + "&api_key=" + apiKey;
 
-        if (res != CURLE_OK) {
-            cerr << "cURL request failed: " << curl_easy_strerror(res) << endl;
-            neo_data = "";  // Return empty string if the request fails
+        // Windows already in the cache are merged without a request
+        if (options.cache && options.cache->lookup(options.baseUrl, window.startDate, window.endDate, window.body)) {
+            if (mergeWindow(result, window, options.baseUrl)) continue;
         }
+        window.body.clear();
+        windows.push_back(window);
+    }
 
-        curl_easy_cleanup(curl);
+    FetchSession session; // Declared before the multi handle, so it outlives every transfer
+    CURLM* multi = curl_multi_init();
+    size_t limit = static_cast<size_t>(max(options.maxParallel, 1));
+    size_t next = 0;
+    size_t active = 0;
+    bool ok = true;
+    for (; ok && next < windows.size() && active < limit; next++) {
+        ok = addWindowTransfer(multi, session, windows, next);
+        if (ok) active++;
     }
-    return neo_data;
+
+    while (active > 0) {
+        int stillRunning = 0;
+        curl_multi_perform(multi, &stillRunning);
+
+        CURLMsg* message;
+        int queued;
+        while ((message = curl_multi_info_read(multi, &queued))) {
+            if (message->msg != CURLMSG_DONE) continue;
+            CURL* curl = message->easy_handle;
+            char* privateData = nullptr;
+            long status = 0;
+            curl_easy_getinfo(curl, CURLINFO_PRIVATE, &privateData);
+            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+            size_t index = reinterpret_cast<size_t>(privateData);
+
+            // Parse finished windows while the others are still downloading
+            if (message->data.result != CURLE_OK) {
+                cerr << "cURL request failed for " << describeWindow(windows[index], options.baseUrl) << ": "
+                     << curl_easy_strerror(message->data.result) << endl;
+                ok = false;
+            } else if (status != 200) {
+                cerr << "NASA API returned HTTP " << status << " for "
+                     << describeWindow(windows[index], options.baseUrl) << endl;
+                ok = false;
+            } else if (ok) {
+                ok = mergeWindow(result, windows[index], options.baseUrl);
+                if (ok && options.cache) {
+                    options.cache->store(options.baseUrl, windows[index].startDate, windows[index].endDate, windows[index].body);
+                }
+            }
+            windows[index].body.clear();
+            windows[index].body.shrink_to_fit();
+
+            curl_multi_remove_handle(multi, curl);
+            curl_easy_cleanup(curl);
+            active--;
+            if (ok && next < windows.size()) {
+                ok = addWindowTransfer(multi, session, windows, next++);
+                if (ok) active++;
+            }
+        }
+        if (active > 0) {
+            curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+        }
+    }
+    curl_multi_cleanup(multi);
+
+    if (!ok) {
+        result = json();
+    }
+    return ok;
 }
 
 // Function to load data from a local JSON file
 bool load_from_file(json& jsonData, const string& filename) {
-    ifstream file(filename);
-    if (!file.is_open()) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        cerr << "Could not open the file!" << endl;
+        return false;
+    }
+    jsonData = json::parse(file.begin(), file.end());
+    return true;
+}
+
+// Function to load only one date of a local JSON feed file
+bool load_date_from_file(json& jsonData, const string& filename, const string& selectedDate) {
+    MappedFile file;
+    if (!file.open(filename)) {
         cerr << "Could not open the file!" << endl;
         return false;
     }
-    file >> jsonData;
+    // Drop every other top-level member and every other date while parsing,
+    // so they are never built into the DOM
+    jsonData = json::parse(file.begin(), file.end(),
+        [&selectedDate](int depth, json::parse_event_t event, json& parsed) {
+            if (event != json::parse_event_t::key) return true;
+            if (depth == 1) return parsed == "near_earth_objects";
+            if (depth == 2) return parsed == selectedDate;
+            return true;
+        });
     return true;
 }
 
@@ -130,7 +290,7 @@ json process_neo_data(const json& jsonData, const string& selectedDate) {
     try {
         auto& neo_objects = jsonData["near_earth_objects"];
         if (neo_objects.contains(selectedDate)) {
-            auto neos = neo_objects[selectedDate];
+            const auto& neos = neo_objects[selectedDate];
             cout << "\nThere are " << neos.size() << " NEOs for the date " << selectedDate << ".\n";
 
             for (size_t i = 0; i < neos.size(); i++) {
@@ -141,7 +301,7 @@ json process_neo_data(const json& jsonData, const string& selectedDate) {
             cout << "\nSelect a NEO by number: ";
             cin >> neo_choice;
 
-            if (neo_choice > 0 && neo_choice <= neos.size()) {
+            if (neo_choice > 0 && static_cast<size_t>(neo_choice) <= neos.size()) {
                 return neos[neo_choice - 1]; // Return the selected NEO JSON object
             } else {
                 cout << "Invalid choice, please select a valid NEO number." << endl;
@@ -11,8 +11,13 @@
 void loadEnvFile(const std::string& filename);
 
 // Loads NEO data from a file into a json object
+// The file is memory-mapped and parsed in place
 bool load_from_file(nlohmann::json& jsonData, const std::string& filename);
 
+// Loads only the NEOs listed under selectedDate, in the same feed layout
+// process_neo_data expects. Other dates are skipped during parsing.
+bool load_date_from_file(nlohmann::json& jsonData, const std::string& filename, const std::string& selectedDate);
+
 // Callback for writing API response data into a string
 size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::string* s);
 
@@ -23,6 +28,29 @@ void output_neo_data(const nlohmann::json& neo);
 nlohmann::json process_neo_data(const nlohmann::json& jsonData, const std::string& selectedDate);
 
 // Fetches NEO data from NASA's API for a specific date
+// Responses are cached on disk (see response_cache.h)
 std::string fetch_neo_data(const std::string& date, const std::string& apiKey);
 
+// Base URL of the NeoWs feed endpoint
+inline constexpr const char* neoFeedUrl = "https://api.nasa.gov/neo/rest/v1/feed";
+
+// The feed endpoint returns at most this many days per request
+const int maxFeedWindowDays = 7;
+
+class ResponseCache;
+
+// Settings for fetch_neo_range
+struct RangeFetchOptions {
+    int maxParallel = 4;            // Requests in flight at the same time
+    std::string baseUrl = neoFeedUrl;
+    ResponseCache* cache = nullptr; // Windows found here are not requested again
+};
+
+// Fetches every date in [startDate, endDate] (YYYY-MM-DD, inclusive).
+// The span is split into 7-day windows that are downloaded concurrently
+// through the curl multi interface. The per-window near_earth_objects maps
+// are merged into one feed in result. Returns false if any window fails.
+bool fetch_neo_range(nlohmann::json& result, const std::string& startDate, const std::string& endDate,
+                     const std::string& apiKey, const RangeFetchOptions& options = RangeFetchOptions());
+
 #endif // GET_DATA_H
\ No newline at end of file
@@ -0,0 +1,136 @@
+// src/hazard_screen.cpp
+
+#include "hazard_screen.h"
+#include "body_physics.h"
+#include "planets.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const double msPerDay = 86400000.0;
+const double msPerYear = 365.25 * msPerDay;
+const double earthEscapeVelocity = SolarSystem::predefinedPlanets[2].escapeVelocity; // km/s
+
+// The value a criterion ranks by, higher being more hazardous
+template <typename Entry>
+double key(const Entry& entry, size_t criterion) {
+    switch (static_cast<HazardCriterion>(criterion)) {
+    case HazardCriterion::ImpactEnergy: return entry.impactEnergy;
+    case HazardCriterion::MissDistance: return -entry.missEarthRadii;
+    default: return entry.palermo;
+    }
+}
+
+// Whether a ranks strictly above b: by the criterion, then the earlier
+// approach, then the smaller id
+bool ranksAbove(const HazardEntry& a, const HazardEntry& b, size_t criterion) {
+    double keyA = key(a, criterion);
+    double keyB = key(b, criterion);
+    if (keyA != keyB) return keyA > keyB;
+    if (a.epochMs != b.epochMs) return a.epochMs < b.epochMs;
+    return a.id < b.id;
+}
+
+} // namespace
+
+HazardScreen::HazardScreen(size_t count, int64_t referenceEpochMs)
+    : count(count), referenceEpochMs(referenceEpochMs) {}
+
+double HazardScreen::palermoScore(double impactEnergy, double missDistanceKm, double velocityKmPerS,
+                                  double yearsUntil) {
+    double focusing = earthEscapeVelocity / velocityKmPerS;
+    double crossSectionKm = BodyPhysics::earthRadiusKm * sqrt(1 + focusing * focusing);
+    double ratio = crossSectionKm / missDistanceKm;
+    double probability = min(1.0, ratio * ratio);
+    double backgroundRate = 0.03 * pow(impactEnergy, -0.8);
+    return log10(probability / (backgroundRate * yearsUntil));
+}
+
+HazardScreen::Candidate HazardScreen::candidate(double massKg, double velocityKmPerS, double missDistanceKm,
+                                                int64_t epochMs) const {
+    double energy = BodyPhysics::impactEnergy(massKg, velocityKmPerS);
+    double years = max(fabs(static_cast<double>(epochMs - referenceEpochMs)), msPerDay) / msPerYear;
+    return {epochMs, energy, missDistanceKm / BodyPhysics::earthRadiusKm,
+            palermoScore(energy, missDistanceKm, velocityKmPerS, years)};
+}
+
+template <typename Describe>
+void HazardScreen::offer(const Candidate& candidate, const Describe& describe) {
+    screenedCount++;
+    HazardEntry entry;
+    bool described = false;
+    for (size_t criterion = 0; criterion < 3; criterion++) {
+        auto& heap = heaps[criterion];
+        auto below = [criterion](const HazardEntry& a, const HazardEntry& b) { return ranksAbove(a, b, criterion); };
+        if (count == 0) continue;
+
+        if (heap.size() == count) {
+            // The root is the least hazardous entry kept; most candidates stop here
+            const HazardEntry& least = heap.front();
+            double candidateKey = key(candidate, criterion);
+            double leastKey = key(least, criterion);
+            if (candidateKey < leastKey || (candidateKey == leastKey && candidate.epochMs > least.epochMs)) continue;
+        }
+        if (!described) {
+            entry = {string(), string(), candidate.epochMs, candidate.impactEnergy,
+                     candidate.missEarthRadii, candidate.palermo};
+            describe(entry);
+            described = true;
+        }
+        if (heap.size() == count) {
+            if (!ranksAbove(entry, heap.front(), criterion)) continue;
+            pop_heap(heap.begin(), heap.end(), below);
+            heap.back() = entry;
+        } else {
+            heap.push_back(entry);
+        }
+        push_heap(heap.begin(), heap.end(), below);
+    }
+}
+
+void HazardScreen::add(const Asteroid& asteroid) {
+    for (const auto& approach : asteroid.getCloseApproachData()) {
+        offer(candidate(asteroid.getMass(), approach.relative_velocity, approach.reported_miss_distance,
+                        approach.epochMs),
+              [&](HazardEntry& entry) {
+                  entry.id = asteroid.getID();
+                  entry.name = asteroid.getName();
+              });
+    }
+}
+
+void HazardScreen::add(const NeoFields& fields) {
+    double mass = BodyPhysics::asteroidMass(fields.minDiameterKm, fields.maxDiameterKm);
+    for (const auto& approach : fields.closeApproaches) {
+        offer(candidate(mass, approach.relative_velocity, approach.miss_distance, approach.epochMs),
+              [&](HazardEntry& entry) {
+                  entry.id = fields.id;
+                  entry.name = fields.name;
+              });
+    }
+}
+
+void HazardScreen::add(const AsteroidTable& table) {
+    const auto& begin = table.approachBegin();
+    const auto& velocities = table.approachVelocityKmPerS();
+    const auto& missDistances = table.approachReportedMissDistanceKm();
+    const auto& epochs = table.approachEpochMs();
+    for (size_t row = 0; row < table.size(); row++) {
+        for (size_t i = begin[row]; i < begin[row + 1]; i++) {
+            offer(candidate(table.mass()[row], velocities[i], missDistances[i], epochs[i]),
+                  [&](HazardEntry& entry) {
+                      entry.id = table.id(row);
+                      entry.name = table.name(row);
+                  });
+        }
+    }
+}
+
+vector<HazardEntry> HazardScreen::top(HazardCriterion criterion) const {
+    size_t index = static_cast<size_t>(criterion);
+    vector<HazardEntry> entries = heaps[index];
+    sort(entries.begin(), entries.end(),
+         [index](const HazardEntry& a, const HazardEntry& b) { return ranksAbove(a, b, index); });
+    return entries;
+}
@@ -0,0 +1,93 @@
+// src/hazard_screen.h
+
+#ifndef HAZARD_SCREEN_H
+#define HAZARD_SCREEN_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "asteroid_table.h"
+#include "classes.h"
+
+using namespace std;
+
+// One screened close approach
+struct HazardEntry {
+    string id;
+    string name;
+    int64_t epochMs;       // Time of closest approach
+    double impactEnergy;   // Megatons of TNT, at the approach velocity
+    double missEarthRadii; // Miss distance as NeoWs reported it
+    double palermo;        // Palermo-style score, see HazardScreen
+};
+
+enum class HazardCriterion { ImpactEnergy, MissDistance, Palermo };
+
+// Screens close approaches one at a time and keeps only the K most
+// hazardous by each criterion: the highest impact energies, the smallest
+// miss distances and the highest Palermo-style scores. Every
+// criterion is a bounded heap whose root is the least hazardous entry kept,
+// so a candidate costs one comparison unless it displaces that root, and the
+// strings of an approach are only copied when it is kept. Memory stays O(K) however many
+// approaches are screened, so a multi-year archive can be screened in one
+// pass straight from stream_from_file.
+//
+// Miss distances are the ones NeoWs reported (reported_miss_distance, and
+// AsteroidTable's reported column), not the halved and floored distance an
+// Asteroid keeps for its own calculations, so grazing approaches still rank
+// against each other.
+//
+// The score follows the Palermo scale, log10(p / (fB * T)), with
+//  - p the chance of a collision, taken as Earth's gravitationally focused
+//    cross-section over the area of a disc the radius of the miss distance,
+//    (b / d)^2 with b = R * sqrt(1 + ve^2 / v^2), capped at 1;
+//  - fB = 0.03 * E^-0.8 per year, the background rate of impacts of at least
+//    the approach's energy E in megatons;
+//  - T the years between the reference time and the approach, at least a day.
+// There is no orbit uncertainty in a feed, so p is only a proxy: scores rank
+// approaches against each other, they are not published Palermo values.
+//
+// Ties are broken by approach time, then by id, so the result does not depend
+// on the order approaches are screened in.
+class HazardScreen {
+public:
+    // Keeps `count` entries per criterion, timing approaches from referenceEpochMs
+    HazardScreen(size_t count, int64_t referenceEpochMs);
+
+    // Screen every close approach of an asteroid, of a NeoWs record, or of each row of a table
+    void add(const Asteroid& asteroid);
+    void add(const NeoFields& fields);
+    void add(const AsteroidTable& table);
+
+    // Kept entries, most hazardous first
+    vector<HazardEntry> top(HazardCriterion criterion) const;
+
+    size_t capacity() const { return count; }
+    size_t screened() const { return screenedCount; } // Close approaches seen so far
+
+    // The score of one approach, as used by the screen
+    static double palermoScore(double impactEnergy, double missDistanceKm, double velocityKmPerS,
+                               double yearsUntil);
+
+private:
+    // The numbers of an approach, before its strings are looked at
+    struct Candidate {
+        int64_t epochMs;
+        double impactEnergy;
+        double missEarthRadii;
+        double palermo;
+    };
+
+    size_t count;
+    int64_t referenceEpochMs;
+    size_t screenedCount = 0;
+    vector<HazardEntry> heaps[3]; // One per HazardCriterion
+
+    Candidate candidate(double massKg, double velocityKmPerS, double missDistanceKm, int64_t epochMs) const;
+
+    template <typename Describe>
+    void offer(const Candidate& candidate, const Describe& describe);
+};
+
+#endif // HAZARD_SCREEN_H
@@ -0,0 +1,108 @@
+// src/impact_matrix.cpp
+
+#include "impact_matrix.h"
+#include "body_physics.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+namespace {
+
+// Rows per parallel task. Rows are independent, so blocks only split the
+// work between threads; large enough to make handing out a block cheap
+const size_t blockRows = 1024;
+
+} // namespace
+
+const vector<double>& ImpactMatrix::values(ImpactQuantity quantity) const {
+    switch (quantity) {
+    case ImpactQuantity::Velocity: return velocities;
+    case ImpactQuantity::Energy: return energies;
+    default: return massChanges;
+    }
+}
+
+void compute_impact_matrix(const double* massKg, const double* velocityKmPerS, size_t count, ImpactMatrix& out,
+                           unsigned threadCount) {
+    const auto& planets = SolarSystem::predefinedPlanets;
+    const size_t columns = planets.size();
+    out.rows = count;
+    out.columns = columns;
+    out.ids.clear();
+    out.velocities.resize(count * columns);
+    out.energies.resize(count * columns);
+    out.massChanges.resize(count * columns);
+
+    double* velocities = out.velocities.data();
+    double* energies = out.energies.data();
+    double* massChanges = out.massChanges.data();
+    size_t blockCount = (count + blockRows - 1) / blockRows;
+    parallel_for(blockCount, threadCount, [&](size_t block) {
+        size_t first = block * blockRows;
+        size_t end = min(count, first + blockRows);
+        // Row by row, so each output is written contiguously: a row's eight
+        // planets are 64 bytes next to the previous row's
+        for (size_t a = first; a < end; a++) {
+            const double approachSquared = velocityKmPerS[a] * velocityKmPerS[a];
+            const double mass = massKg[a];
+            double* velocityRow = velocities + a * columns;
+            double* energyRow = energies + a * columns;
+            double* massChangeRow = massChanges + a * columns;
+            for (size_t p = 0; p < columns; p++) {
+                double velocity = sqrt(approachSquared + planets[p].escapeVelocity * planets[p].escapeVelocity);
+                double velocityMs = velocity * 1000.0;
+                velocityRow[p] = velocity;
+                // The same operations as BodyPhysics::impactEnergy, so the values match it exactly
+                energyRow[p] = 0.5 * mass * (velocityMs * velocityMs) / BodyPhysics::joulesPerMegaton;
+                massChangeRow[p] = -mass / planets[p].mass;
+            }
+        }
+    });
+}
+
+void compute_impact_matrix(const AsteroidTable& table, ImpactMatrix& out, unsigned threadCount) {
+    vector<double> velocities(table.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        velocities[i] = table.firstVelocityKmPerS(i);
+    }
+    compute_impact_matrix(table.mass().data(), velocities.data(), table.size(), out, threadCount);
+    out.ids.reserve(table.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        out.ids.push_back(table.id(i));
+    }
+}
+
+bool export_impact_matrix(const ImpactMatrix& matrix, ImpactQuantity quantity, const string& filename) {
+    ofstream out(filename, ios::trunc);
+    if (!out.is_open()) {
+        cerr << "Could not create " << filename << endl;
+        return false;
+    }
+    out << "asteroid";
+    for (size_t p = 0; p < matrix.columns; p++) {
+        out << ',' << SolarSystem::predefinedPlanets[p].name;
+    }
+    out << '\n';
+
+    const vector<double>& values = matrix.values(quantity);
+    char number[32];
+    for (size_t a = 0; a < matrix.rows; a++) {
+        if (a < matrix.ids.size()) {
+            out << matrix.ids[a];
+        } else {
+            out << a;
+        }
+        for (size_t p = 0; p < matrix.columns; p++) {
+            snprintf(number, sizeof(number), "%.17g", values[a * matrix.columns + p]);
+            out << ',' << number;
+        }
+        out << '\n';
+    }
+    if (!out) {
+        cerr << "Could not write " << filename << endl;
+        return false;
+    }
+    return true;
+}
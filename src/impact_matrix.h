@@ -0,0 +1,47 @@
+// src/impact_matrix.h
+
+#ifndef IMPACT_MATRIX_H
+#define IMPACT_MATRIX_H
+
+#include <string>
+#include <vector>
+#include "asteroid_table.h"
+#include "planets.h"
+
+using namespace std;
+
+enum class ImpactQuantity { Velocity, Energy, MassChange };
+
+// Every asteroid hitting every planet of SolarSystem::predefinedPlanets.
+// Each quantity is a dense row-major matrix with one row per asteroid and
+// one column per planet, in the order of predefinedPlanets.
+struct ImpactMatrix {
+    size_t rows = 0;
+    size_t columns = 0;
+    vector<string> ids;         // Row labels, empty if the inputs had none
+    vector<double> velocities;  // km/s at impact: sqrt(v^2 + ve^2) with ve the planet's escape velocity
+    vector<double> energies;    // Megatons of TNT at that velocity
+    vector<double> massChanges; // Fraction of its mass the planet loses in Planet::handleImpact
+
+    const vector<double>& values(ImpactQuantity quantity) const;
+    double value(ImpactQuantity quantity, size_t asteroid, size_t planet) const {
+        return values(quantity)[asteroid * columns + planet];
+    }
+};
+
+// Fills the matrix for `count` asteroids given as mass and approach velocity
+// columns. Each row is filled planet by planet, so the outputs are written
+// sequentially. Blocks of rows are spread over threadCount threads (0 means
+// one per hardware thread); the results are the same whatever the thread
+// count.
+void compute_impact_matrix(const double* massKg, const double* velocityKmPerS, size_t count, ImpactMatrix& out,
+                           unsigned threadCount = 0);
+
+// Same, for every row of a table at its first close approach, labelled by id
+void compute_impact_matrix(const AsteroidTable& table, ImpactMatrix& out, unsigned threadCount = 0);
+
+// Writes one quantity as CSV: a header of planet names, then one row per
+// asteroid led by its id (or row number), values at full precision
+bool export_impact_matrix(const ImpactMatrix& matrix, ImpactQuantity quantity, const string& filename);
+
+#endif // IMPACT_MATRIX_H
@@ -0,0 +1,113 @@
+// src/impact_monte_carlo.cpp
+
+#include "impact_monte_carlo.h"
+#include "body_physics.h"
+#include "parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"):
+// ten rounds of multiply-and-mix over a 128-bit counter under a 64-bit key
+struct Philox4x32 {
+    uint32_t words[4];
+
+    Philox4x32(uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3, uint64_t key) : words{c0, c1, c2, c3} {
+        uint32_t k0 = static_cast<uint32_t>(key);
+        uint32_t k1 = static_cast<uint32_t>(key >> 32);
+        for (int round = 0; round < 10; round++) {
+            uint64_t product0 = uint64_t(0xD2511F53) * words[0];
+            uint64_t product1 = uint64_t(0xCD9E8D57) * words[2];
+            uint32_t mixed[4] = {
+                static_cast<uint32_t>(product1 >> 32) ^ words[1] ^ k0,
+                static_cast<uint32_t>(product1),
+                static_cast<uint32_t>(product0 >> 32) ^ words[3] ^ k1,
+                static_cast<uint32_t>(product0),
+            };
+            copy(mixed, mixed + 4, words);
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+    }
+
+    // Word i as a double in (0, 1), never exactly 0 so it can go through log
+    double uniform(int i) const { return (words[i] + 0.5) * (1.0 / 4294967296.0); }
+};
+
+} // namespace
+
+ImpactMonteCarlo::ImpactMonteCarlo(ImpactUncertainty model) : settings(std::move(model)) {
+    if (settings.samples == 0 || settings.samples > UINT32_MAX) {
+        throw invalid_argument("Sample count must be between 1 and 2^32 - 1.");
+    }
+    if (!(settings.densityMin > 0) || !(settings.densityMax >= settings.densityMin)) {
+        throw invalid_argument("Density range must be positive and ascending.");
+    }
+    if (!(settings.velocitySigma >= 0)) {
+        throw invalid_argument("Velocity sigma must not be negative.");
+    }
+    for (size_t i = 0; i < settings.percentiles.size(); i++) {
+        double percentile = settings.percentiles[i];
+        if (!(percentile >= 0 && percentile <= 100) || (i > 0 && percentile < settings.percentiles[i - 1])) {
+            throw invalid_argument("Percentiles must be ascending and within [0, 100].");
+        }
+    }
+}
+
+double ImpactMonteCarlo::sample(const ImpactBody& body, uint64_t index, uint32_t sample) const {
+    Philox4x32 random(sample, static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32), 0, settings.seed);
+
+    double diameterKm = body.minDiameterKm + (body.maxDiameterKm - body.minDiameterKm) * random.uniform(0);
+    double density = settings.densityMin + (settings.densityMax - settings.densityMin) * random.uniform(1);
+    // Box-Muller, keeping one of the pair of normal deviates
+    double normal = sqrt(-2.0 * log(random.uniform(2))) * cos(2.0 * M_PI * random.uniform(3));
+    double velocity = max(0.0, body.velocityKmPerS * (1.0 + settings.velocitySigma * normal));
+
+    double radius = diameterKm * 1000.0 / 2.0;
+    double mass = density * (4.0 / 3.0) * M_PI * (radius * radius * radius);
+    return BodyPhysics::impactEnergy(mass, velocity);
+}
+
+void ImpactMonteCarlo::run(const vector<ImpactBody>& bodies, ImpactEnergyStats& out, unsigned threadCount) const {
+    const size_t samples = settings.samples;
+    const vector<double>& percentiles = settings.percentiles;
+    out.percentiles = percentiles;
+    out.means.assign(bodies.size(), 0.0);
+    out.energies.assign(bodies.size() * percentiles.size(), 0.0);
+
+    parallel_for(bodies.size(), threadCount, [&](size_t body) {
+        vector<double> energies(samples);
+        double sum = 0;
+        for (size_t i = 0; i < samples; i++) {
+            energies[i] = sample(bodies[body], body, static_cast<uint32_t>(i));
+            sum += energies[i];
+        }
+        out.means[body] = sum / samples;
+
+        // Each selection only reorders the part above the previous one, which
+        // already holds every value not below it
+        auto first = energies.begin();
+        for (size_t p = 0; p < percentiles.size(); p++) {
+            double position = percentiles[p] / 100.0 * (samples - 1);
+            size_t rank = static_cast<size_t>(position);
+            nth_element(first, energies.begin() + rank, energies.end());
+            first = energies.begin() + rank;
+            double value = energies[rank];
+            double fraction = position - rank;
+            if (fraction > 0 && rank + 1 < samples) {
+                value += fraction * (*min_element(first + 1, energies.end()) - value);
+            }
+            out.energies[body * percentiles.size() + p] = value;
+        }
+    });
+}
+
+vector<ImpactBody> ImpactMonteCarlo::bodiesOf(const AsteroidTable& table) {
+    vector<ImpactBody> bodies(table.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        bodies[i] = {table.minDiameterKm()[i], table.maxDiameterKm()[i], table.firstVelocityKmPerS(i)};
+    }
+    return bodies;
+}
@@ -0,0 +1,72 @@
+// src/impact_monte_carlo.h
+
+#ifndef IMPACT_MONTE_CARLO_H
+#define IMPACT_MONTE_CARLO_H
+
+#include <cstdint>
+#include <vector>
+#include "asteroid_table.h"
+
+using namespace std;
+
+// What is uncertain about an impact, and how much of it to sample
+struct ImpactUncertainty {
+    size_t samples = 10000;                   // Per asteroid
+    uint64_t seed = 20240927;
+    double densityMin = 1500.0;               // kg/m^3, sampled uniformly;
+    double densityMax = 4500.0;               // the default centres on asteroidDensity
+    double velocitySigma = 0.05;              // Relative standard deviation of the approach velocity
+    vector<double> percentiles = {5, 50, 95}; // Ascending, in [0, 100]
+};
+
+// The inputs of one asteroid, as reported
+struct ImpactBody {
+    double minDiameterKm;
+    double maxDiameterKm;
+    double velocityKmPerS;
+};
+
+// Sampled impact energies in megatons of TNT, one row per asteroid
+struct ImpactEnergyStats {
+    vector<double> percentiles; // As requested
+    vector<double> means;       // Per asteroid
+    vector<double> energies;    // percentiles.size() values per asteroid
+
+    size_t size() const { return means.size(); }
+    double energy(size_t body, size_t percentile) const { return energies[body * percentiles.size() + percentile]; }
+};
+
+// Monte Carlo estimate of the impact energy distribution of each asteroid.
+// Every sample draws a diameter uniformly between the two estimates, a
+// density uniformly between densityMin and densityMax, and a velocity from
+// a normal distribution around the reported one; the mass is that of a
+// sphere of the sampled diameter and density.
+// Random numbers come from a counter-based generator (Philox4x32-10): the
+// numbers of sample s of asteroid i are a pure function of (seed, i, s), so
+// no generator state is carried between samples or shared between threads,
+// and the results are the same bit for bit whatever the thread count.
+// Percentiles interpolate linearly between the nearest order statistics.
+class ImpactMonteCarlo {
+public:
+    // Throws invalid_argument if the model has no samples, a density range
+    // that is not positive and ascending, a negative sigma, or percentiles
+    // that are out of range or not ascending
+    explicit ImpactMonteCarlo(ImpactUncertainty model = {});
+
+    const ImpactUncertainty& model() const { return settings; }
+
+    // Energy of sample `sample` of the asteroid at `index`, in megatons
+    double sample(const ImpactBody& body, uint64_t index, uint32_t sample) const;
+
+    // Samples every body, spreading the bodies over threadCount threads
+    // (0 means one per hardware thread)
+    void run(const vector<ImpactBody>& bodies, ImpactEnergyStats& out, unsigned threadCount = 0) const;
+
+    // The bodies of a table, at each row's first close approach
+    static vector<ImpactBody> bodiesOf(const AsteroidTable& table);
+
+private:
+    ImpactUncertainty settings;
+};
+
+#endif // IMPACT_MONTE_CARLO_H
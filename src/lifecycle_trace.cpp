@@ -0,0 +1,120 @@
+// src/lifecycle_trace.cpp
+
+#include "lifecycle_trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+atomic<uint8_t> LifecycleTrace::currentLevel(static_cast<uint8_t>(TraceLevel::Off));
+atomic<uint64_t> LifecycleTrace::nextSequence(0);
+
+namespace {
+
+const size_t nameWords = LifecycleTrace::maxNameLength / 8;
+
+// One ring slot. stamp is sequence + 1 once the slot is written and 0 while a
+// writer fills it; readers check it before and after copying the payload
+// (a seqlock). The payload is atomic too, so a torn read is discarded rather
+// than undefined.
+struct alignas(64) Slot {
+    atomic<uint64_t> stamp{0};
+    atomic<uint64_t> nanoseconds{0};
+    atomic<uint32_t> kind{0}; // body | event << 8 | name length << 16
+    atomic<uint64_t> name[nameWords];
+};
+
+Slot ring[LifecycleTrace::capacity];
+
+uint64_t now() {
+    return static_cast<uint64_t>(
+        chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+void LifecycleTrace::record(TraceBody body, TraceEvent event, string_view name) {
+    uint64_t sequence = nextSequence.fetch_add(1, memory_order_relaxed);
+    Slot& slot = ring[sequence % capacity];
+
+    uint64_t words[nameWords] = {};
+    size_t length = min(name.size(), maxNameLength);
+    memcpy(words, name.data(), length);
+
+    slot.stamp.store(0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot.nanoseconds.store(now(), memory_order_relaxed);
+    slot.kind.store(static_cast<uint32_t>(body) | static_cast<uint32_t>(event) << 8 |
+                        static_cast<uint32_t>(length) << 16,
+                    memory_order_relaxed);
+    for (size_t i = 0; i < nameWords; i++) {
+        slot.name[i].store(words[i], memory_order_relaxed);
+    }
+    slot.stamp.store(sequence + 1, memory_order_release);
+}
+
+vector<TraceRecord> LifecycleTrace::snapshot() {
+    uint64_t end = nextSequence.load(memory_order_acquire);
+    uint64_t begin = end > capacity ? end - capacity : 0;
+
+    vector<TraceRecord> records;
+    records.reserve(end - begin);
+    for (uint64_t sequence = begin; sequence < end; sequence++) {
+        const Slot& slot = ring[sequence % capacity];
+        uint64_t stamp = slot.stamp.load(memory_order_acquire);
+        if (stamp != sequence + 1) {
+            continue; // Not written yet, or already overwritten
+        }
+        uint64_t nanoseconds = slot.nanoseconds.load(memory_order_relaxed);
+        uint32_t kind = slot.kind.load(memory_order_relaxed);
+        uint64_t words[nameWords];
+        for (size_t i = 0; i < nameWords; i++) {
+            words[i] = slot.name[i].load(memory_order_relaxed);
+        }
+        atomic_thread_fence(memory_order_acquire);
+        if (slot.stamp.load(memory_order_relaxed) != stamp) {
+            continue; // A writer took the slot while it was being copied
+        }
+
+        TraceRecord record;
+        record.sequence = sequence;
+        record.nanoseconds = nanoseconds;
+        record.body = static_cast<TraceBody>(kind & 0xff);
+        record.event = static_cast<TraceEvent>((kind >> 8) & 0xff);
+        record.name.assign(reinterpret_cast<const char*>(words), min<size_t>(kind >> 16, maxNameLength));
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+void LifecycleTrace::dump(ostream& out) {
+    for (const auto& record : snapshot()) {
+        out << '#' << record.sequence << ' ' << trace_body_name(record.body) << ' ' << record.name << ' '
+            << trace_event_name(record.event) << '\n';
+    }
+    out.flush();
+}
+
+void LifecycleTrace::clear() {
+    for (auto& slot : ring) {
+        slot.stamp.store(0, memory_order_relaxed);
+    }
+    nextSequence.store(0, memory_order_release);
+}
+
+const char* trace_body_name(TraceBody body) {
+    switch (body) {
+        case TraceBody::SpaceBody: return "Space body";
+        case TraceBody::Planet: return "Planet";
+        case TraceBody::Asteroid: return "Asteroid";
+    }
+    return "Unknown body";
+}
+
+const char* trace_event_name(TraceEvent event) {
+    switch (event) {
+        case TraceEvent::Constructed: return "constructed";
+        case TraceEvent::Copied: return "copied";
+        case TraceEvent::Destroyed: return "destroyed";
+    }
+    return "unknown event";
+}
@@ -0,0 +1,95 @@
+// src/lifecycle_trace.h
+
+#ifndef LIFECYCLE_TRACE_H
+#define LIFECYCLE_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// Compile-time switch for lifecycle tracing. Build with
+// -DSPACE_BODY_TRACE=0 and the TRACE_LIFECYCLE calls compile to nothing.
+#ifndef SPACE_BODY_TRACE
+#define SPACE_BODY_TRACE 1
+#endif
+
+// How much is recorded at run time
+enum class TraceLevel : uint8_t {
+    Off = 0,
+    Lifecycle = 1, // Copies and destructions
+    Verbose = 2    // Constructions as well
+};
+
+enum class TraceEvent : uint8_t { Constructed, Copied, Destroyed };
+
+enum class TraceBody : uint8_t { SpaceBody, Planet, Asteroid };
+
+// One recorded event, as returned by LifecycleTrace::snapshot()
+struct TraceRecord {
+    uint64_t sequence = 0;    // Position in the trace, counting from 0
+    uint64_t nanoseconds = 0; // steady_clock time
+    TraceBody body = TraceBody::SpaceBody;
+    TraceEvent event = TraceEvent::Constructed;
+    string name;              // Truncated to LifecycleTrace::maxNameLength
+};
+
+// Process-wide trace of SpaceBody lifecycle events.
+// Events go into a fixed ring buffer of `capacity` slots: a writer claims a
+// slot with one atomic increment and never blocks or allocates, so tracing
+// stays cheap while many bodies are created and destroyed, from any thread.
+// When the ring is full the oldest events are overwritten. snapshot() and
+// dump() read the events still held, skipping any slot a writer is in the
+// middle of.
+class LifecycleTrace {
+public:
+    static constexpr size_t capacity = 4096;
+    static constexpr size_t maxNameLength = 40;
+
+    static void setLevel(TraceLevel level) { currentLevel.store(static_cast<uint8_t>(level), memory_order_relaxed); }
+    static TraceLevel level() { return static_cast<TraceLevel>(currentLevel.load(memory_order_relaxed)); }
+    static bool enabled(TraceLevel needed) {
+        return currentLevel.load(memory_order_relaxed) >= static_cast<uint8_t>(needed);
+    }
+
+    static void record(TraceBody body, TraceEvent event, string_view name);
+
+    // Events still in the ring, oldest first
+    static vector<TraceRecord> snapshot();
+
+    // Writes snapshot() as one line per event, e.g. "#12 Asteroid 433 Eros destroyed"
+    static void dump(ostream& out);
+
+    // Number of events recorded so far, including overwritten ones
+    static uint64_t recorded() { return nextSequence.load(memory_order_relaxed); }
+
+    // Forgets all events; not safe while other threads are recording
+    static void clear();
+
+private:
+    static atomic<uint8_t> currentLevel;
+    static atomic<uint64_t> nextSequence;
+};
+
+const char* trace_body_name(TraceBody body);
+const char* trace_event_name(TraceEvent event);
+
+// Records a lifecycle event if tracing is compiled in and `level` is enabled
+#if SPACE_BODY_TRACE
+#define TRACE_LIFECYCLE(level, body, event, name)               \
+    do {                                                        \
+        if (LifecycleTrace::enabled(level)) {                   \
+            LifecycleTrace::record((body), (event), (name));    \
+        }                                                       \
+    } while (0)
+#else
+#define TRACE_LIFECYCLE(level, body, event, name) \
+    do {                                          \
+    } while (0)
+#endif
+
+#endif // LIFECYCLE_TRACE_H
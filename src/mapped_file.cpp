@@ -0,0 +1,144 @@
+// src/mapped_file.cpp
+
+#include "mapped_file.h"
+#include <utility>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : mappedData(nullptr), mappedSize(0), opened(false)
+#if defined(_WIN32) || defined(_WIN64)
+    , fileHandle(nullptr), mappingHandle(nullptr)
+#endif
+{}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : MappedFile() {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        swap(mappedData, other.mappedData);
+        swap(mappedSize, other.mappedSize);
+        swap(opened, other.opened);
+#if defined(_WIN32) || defined(_WIN64)
+        swap(fileHandle, other.fileHandle);
+        swap(mappingHandle, other.mappingHandle);
+#endif
+    }
+    return *this;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+
+bool MappedFile::open(const string& filename) {
+    close();
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    opened = true;
+    mappedSize = static_cast<size_t>(fileSize.QuadPart);
+    if (mappedSize == 0) {
+        return true; // Nothing to map, but the file exists
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        close();
+        return false;
+    }
+    mappingHandle = mapping;
+    mappedData = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (mappedData == nullptr) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+    if (mappedData) UnmapViewOfFile(mappedData);
+    if (mappingHandle) CloseHandle(static_cast<HANDLE>(mappingHandle));
+    if (fileHandle) CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappedData = nullptr;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+    mappedSize = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const string& filename) {
+    close();
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    opened = true;
+    mappedSize = static_cast<size_t>(info.st_size);
+    if (mappedSize == 0) {
+        ::close(fd);
+        return true; // mmap rejects zero-length mappings
+    }
+
+    void* addr = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps its own reference to the file
+    if (addr == MAP_FAILED) {
+        mappedSize = 0;
+        opened = false;
+        return false;
+    }
+    madvise(addr, mappedSize, MADV_SEQUENTIAL);
+    mappedData = static_cast<const char*>(addr);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mappedData) {
+        munmap(const_cast<char*>(mappedData), mappedSize);
+    }
+    mappedData = nullptr;
+    mappedSize = 0;
+    opened = false;
+}
+
+#endif
+
+bool MappedFile::isOpen() const {
+    return opened;
+}
+
+const char* MappedFile::data() const {
+    return mappedData ? mappedData : "";
+}
+
+size_t MappedFile::size() const {
+    return mappedSize;
+}
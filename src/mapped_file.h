@@ -0,0 +1,44 @@
+// src/mapped_file.h
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+// Read-only memory mapping of a whole file.
+// The parser reads the mapped pages directly, so the bytes are not copied
+// into a stream buffer first. The mapping is advised for sequential access,
+// which lets the kernel read ahead aggressively on large feeds.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Maps the file, returns false if it cannot be opened or mapped
+    bool open(const string& filename);
+    void close();
+
+    bool isOpen() const;
+    const char* data() const;
+    size_t size() const;
+    const char* begin() const { return data(); }
+    const char* end() const { return data() + size(); }
+
+private:
+    const char* mappedData;
+    size_t mappedSize;
+    bool opened;
+#if defined(_WIN32) || defined(_WIN64)
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
+
+#endif // MAPPED_FILE_H
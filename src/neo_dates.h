@@ -0,0 +1,169 @@
+// src/neo_dates.h
+
+#ifndef NEO_DATES_H
+#define NEO_DATES_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+// Calendar helpers for the YYYY-MM-DD dates used by NeoWs.
+// Days are counted from 1970-01-01 in the proleptic Gregorian calendar
+// (H. Hinnant's civil date algorithms), so date ranges become integer ranges.
+namespace NeoDates {
+    const int64_t msPerDay = 86400000;
+
+    inline int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+        y -= m <= 2;
+        const int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(y - era * 400);
+        const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<int64_t>(doe) - 719468;
+    }
+
+    inline void civilFromDays(int64_t days, int64_t& y, unsigned& m, unsigned& d) {
+        const int64_t z = days + 719468;
+        const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(z - era * 146097);
+        const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const unsigned mp = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp < 10 ? mp + 3 : mp - 9;
+        y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+    }
+
+    inline bool isLeapYear(int64_t y) {
+        return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    }
+
+    // Days in month m (1-12) of year y
+    inline unsigned daysInMonth(int64_t y, unsigned m) {
+        static const unsigned lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return m == 2 && isLeapYear(y) ? 29 : lengths[m - 1];
+    }
+
+    // Parses exactly YYYY-MM-DD, with two-digit months and days, without
+    // sscanf; returns false for anything else
+    inline bool parseDate(string_view text, int64_t& days) {
+        if (text.size() != 10 || text[4] != '-' || text[7] != '-') {
+            return false;
+        }
+        unsigned value[8];
+        const int positions[8] = {0, 1, 2, 3, 5, 6, 8, 9};
+        for (int i = 0; i < 8; i++) {
+            value[i] = static_cast<unsigned>(text[positions[i]] - '0');
+            if (value[i] > 9) return false;
+        }
+        int64_t y = value[0] * 1000 + value[1] * 100 + value[2] * 10 + value[3];
+        unsigned m = value[4] * 10 + value[5];
+        unsigned d = value[6] * 10 + value[7];
+        if (m < 1 || m > 12 || d < 1 || d > daysInMonth(y, m)) {
+            return false;
+        }
+        days = daysFromCivil(y, m, d);
+        return true;
+    }
+
+    // Month number of a three-letter English abbreviation ("Jan".."Dec"), 0 if none
+    inline unsigned monthFromName(const char* name) {
+        static const char names[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+        for (unsigned month = 0; month < 12; month++) {
+            if (memcmp(name, names + month * 3, 3) == 0) return month + 1;
+        }
+        return 0;
+    }
+
+    // Parses a close_approach_date_full value, "YYYY-Mon-DD hh:mm" in UTC
+    // (for example "2024-Sep-30 02:06"), into milliseconds since the epoch.
+    // Fixed positions, no sscanf or locale; returns false for anything else.
+    inline bool parseFullDate(string_view text, int64_t& epochMs) {
+        if (text.size() != 17 || text[4] != '-' || text[8] != '-' || text[11] != ' ' || text[14] != ':') {
+            return false;
+        }
+        unsigned value[8];
+        const int positions[8] = {0, 1, 2, 3, 9, 10, 12, 13};
+        for (int i = 0; i < 8; i++) {
+            value[i] = static_cast<unsigned>(text[positions[i]] - '0');
+            if (value[i] > 9) return false;
+        }
+        unsigned minuteTens = static_cast<unsigned>(text[15] - '0');
+        unsigned minuteUnits = static_cast<unsigned>(text[16] - '0');
+        if (minuteTens > 5 || minuteUnits > 9) return false;
+
+        int64_t y = value[0] * 1000 + value[1] * 100 + value[2] * 10 + value[3];
+        unsigned m = monthFromName(text.data() + 5);
+        unsigned d = value[4] * 10 + value[5];
+        unsigned hour = value[6] * 10 + value[7];
+        if (m == 0 || d < 1 || d > daysInMonth(y, m) || hour > 23) {
+            return false;
+        }
+        int64_t minutes = hour * 60 + minuteTens * 10 + minuteUnits;
+        epochMs = daysFromCivil(y, m, d) * msPerDay + minutes * 60000;
+        return true;
+    }
+
+    inline string formatDate(int64_t days) {
+        int64_t y;
+        unsigned m, d;
+        civilFromDays(days, y, m, d);
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02u", static_cast<long long>(y), m, d);
+        return buffer;
+    }
+
+    // Day containing an epoch in milliseconds (UTC)
+    inline int64_t daysFromEpochMs(int64_t epochMs) {
+        return (epochMs >= 0 ? epochMs : epochMs - (msPerDay - 1)) / msPerDay;
+    }
+}
+
+// A calendar day held as days since 1970-01-01: four bytes in place of a
+// "YYYY-MM-DD" string, so a close approach needs no allocation for its date.
+// Converts implicitly from YYYY-MM-DD text and throws invalid_argument for
+// anything else; str() and operator<< print it back in the same form.
+class NeoDate {
+public:
+    NeoDate() = default;
+    NeoDate(const char* text) : NeoDate(string_view(text)) {}
+    NeoDate(const string& text) : NeoDate(string_view(text)) {}
+    NeoDate(string_view text) {
+        if (!parse(text, *this)) {
+            throw invalid_argument("Invalid date: " + string(text));
+        }
+    }
+
+    static NeoDate fromDays(int64_t days) {
+        NeoDate date;
+        date.dayCount = static_cast<int32_t>(days);
+        return date;
+    }
+
+    // Returns false, leaving date unchanged, unless text is YYYY-MM-DD
+    static bool parse(string_view text, NeoDate& date) {
+        int64_t days;
+        if (!NeoDates::parseDate(text, days)) return false;
+        date.dayCount = static_cast<int32_t>(days);
+        return true;
+    }
+
+    int32_t days() const { return dayCount; }
+    string str() const { return NeoDates::formatDate(dayCount); }
+
+    friend bool operator==(NeoDate a, NeoDate b) { return a.dayCount == b.dayCount; }
+    friend bool operator!=(NeoDate a, NeoDate b) { return a.dayCount != b.dayCount; }
+    friend bool operator<(NeoDate a, NeoDate b) { return a.dayCount < b.dayCount; }
+    friend ostream& operator<<(ostream& out, NeoDate date) { return out << date.str(); }
+
+private:
+    int32_t dayCount = 0;
+};
+
+#endif // NEO_DATES_H
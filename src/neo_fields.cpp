@@ -0,0 +1,210 @@
+// src/neo_fields.cpp
+
+#include "neo_fields.h"
+#include "neo_numbers.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace {
+
+// Marks a close approach whose time has not been read yet
+const int64_t noEpoch = INT64_MIN;
+
+// Field table for one level of a NeoWs object, built once and reused.
+// Fields are kept sorted by key. json objects iterate in key order too, so
+// extract() matches every field in a single merge walk over the object,
+// without hashing or repeated lookups.
+template <typename Target>
+class FieldTable {
+public:
+    // Stores one value in the target; returns nullptr, or what is wrong with the value
+    using Reader = const char* (*)(const json& value, Target& target);
+
+    struct Field {
+        const char* key;
+        Reader read;
+        bool required = true;
+    };
+
+    // prefix is the path of this level, used in error messages
+    FieldTable(const char* prefix, initializer_list<Field> list)
+        : prefix(prefix), fields(list) {
+        sort(fields.begin(), fields.end(), [](const Field& a, const Field& b) { return strcmp(a.key, b.key) < 0; });
+        requiredFields = 0;
+        for (size_t i = 0; i < fields.size(); i++) {
+            if (fields[i].required) requiredFields |= 1u << i;
+        }
+    }
+
+    void extract(const json& object, Target& target) const {
+        if (!object.is_object()) {
+            throw invalid_argument(string("NEO field ") + (*prefix ? prefix : "record") + " is not an object");
+        }
+        uint32_t found = 0;
+        size_t next = 0;
+        for (auto it = object.begin(); it != object.end() && next < fields.size(); ++it) {
+            const string& key = it.key();
+            int order = 1;
+            while (next < fields.size() && (order = key.compare(fields[next].key)) > 0) {
+                next++;
+            }
+            if (order != 0) continue; // Not part of the schema
+            if (const char* problem = fields[next].read(it.value(), target)) {
+                throw invalid_argument("NEO field " + string(prefix) + fields[next].key + " " + problem);
+            }
+            found |= 1u << next;
+            next++;
+        }
+        if ((found & requiredFields) != requiredFields) {
+            for (size_t i = 0; i < fields.size(); i++) {
+                if ((requiredFields & ~found) & (1u << i)) {
+                    throw out_of_range("NEO field " + string(prefix) + fields[i].key + " is missing");
+                }
+            }
+        }
+    }
+
+private:
+    const char* prefix;
+    vector<Field> fields;
+    uint32_t requiredFields;
+};
+
+template <typename Target, string Target::*member>
+const char* readString(const json& value, Target& target) {
+    if (!value.is_string()) return "is not a string";
+    target.*member = value.get_ref<const string&>();
+    return nullptr;
+}
+
+template <typename Target, double Target::*member>
+const char* readNumber(const json& value, Target& target) {
+    if (!value.is_number()) return "is not a number";
+    target.*member = value.get<double>();
+    return nullptr;
+}
+
+// NeoWs sends velocities and distances as strings
+template <typename Target, double Target::*member>
+const char* readNumericString(const json& value, Target& target) {
+    if (!value.is_string()) return "is not a string";
+    const char* reason = nullptr;
+    if (!decode_number(value.get_ref<const string&>(), target.*member, &reason)) return reason;
+    return nullptr;
+}
+
+const char* readDate(const json& value, CloseApproachData& approach) {
+    if (!value.is_string()) return "is not a string";
+    if (!NeoDate::parse(value.get_ref<const string&>(), approach.date)) return "is not a YYYY-MM-DD date";
+    return nullptr;
+}
+
+const char* readFullDate(const json& value, CloseApproachData& approach) {
+    if (!value.is_string()) return "is not a string";
+    if (!NeoDates::parseFullDate(value.get_ref<const string&>(), approach.epochMs)) {
+        return "is not a YYYY-Mon-DD hh:mm date";
+    }
+    return nullptr;
+}
+
+// Read after close_approach_date_full (keys are walked in order), so the exact
+// epoch wins when both are present
+const char* readEpoch(const json& value, CloseApproachData& approach) {
+    if (!value.is_number_integer()) return "is not an integer";
+    approach.epochMs = value.get<int64_t>();
+    return nullptr;
+}
+
+const char* readHazardous(const json& value, NeoFields& fields) {
+    if (!value.is_boolean()) return "is not a boolean";
+    fields.potentiallyHazardous = value.get<bool>();
+    return nullptr;
+}
+
+// "relative_velocity": {"kilometers_per_second": "..."}
+const char* readVelocity(const json& value, CloseApproachData& approach) {
+    static const FieldTable<CloseApproachData> table("close_approach_data.relative_velocity.", {
+        {"kilometers_per_second", readNumericString<CloseApproachData, &CloseApproachData::relative_velocity>},
+    });
+    table.extract(value, approach);
+    return nullptr;
+}
+
+// "miss_distance": {"kilometers": "..."}
+const char* readMissDistance(const json& value, CloseApproachData& approach) {
+    static const FieldTable<CloseApproachData> table("close_approach_data.miss_distance.", {
+        {"kilometers", readNumericString<CloseApproachData, &CloseApproachData::miss_distance>},
+    });
+    table.extract(value, approach);
+    return nullptr;
+}
+
+const char* readCloseApproaches(const json& value, NeoFields& fields) {
+    static const FieldTable<CloseApproachData> table("close_approach_data.", {
+        {"close_approach_date", readDate},
+        {"close_approach_date_full", readFullDate, false},
+        {"epoch_date_close_approach", readEpoch, false},
+        {"relative_velocity", readVelocity},
+        {"miss_distance", readMissDistance},
+    });
+    if (!value.is_array()) return "is not an array";
+    fields.closeApproaches.resize(value.size());
+    size_t index = 0;
+    for (const auto& approach : value) {
+        CloseApproachData& data = fields.closeApproaches[index++];
+        data.epochMs = noEpoch;
+        table.extract(approach, data);
+        if (data.epochMs == noEpoch) {
+            data.epochMs = data.date.days() * NeoDates::msPerDay; // Only the day is known
+        }
+        data.reported_miss_distance = data.miss_distance;
+    }
+    return nullptr;
+}
+
+// "kilometers": {"estimated_diameter_min": ..., "estimated_diameter_max": ...}
+const char* readKilometers(const json& value, NeoFields& fields) {
+    static const FieldTable<NeoFields> table("estimated_diameter.kilometers.", {
+        {"estimated_diameter_min", readNumber<NeoFields, &NeoFields::minDiameterKm>},
+        {"estimated_diameter_max", readNumber<NeoFields, &NeoFields::maxDiameterKm>},
+    });
+    table.extract(value, fields);
+    return nullptr;
+}
+
+// Only the kilometre estimates are used; meters, miles and feet are skipped
+const char* readDiameter(const json& value, NeoFields& fields) {
+    static const FieldTable<NeoFields> table("estimated_diameter.", {
+        {"kilometers", readKilometers},
+    });
+    table.extract(value, fields);
+    return nullptr;
+}
+
+} // namespace
+
+// Function to read the fields of a NeoWs object in one pass
+void extract_neo_fields(const json& neo, NeoFields& fields) {
+    static const FieldTable<NeoFields> table("", {
+        {"id", readString<NeoFields, &NeoFields::id>},
+        {"name", readString<NeoFields, &NeoFields::name>},
+        {"nasa_jpl_url", readString<NeoFields, &NeoFields::nasaJplUrl>},
+        {"absolute_magnitude_h", readNumber<NeoFields, &NeoFields::absoluteMagnitude>},
+        {"estimated_diameter", readDiameter},
+        {"is_potentially_hazardous_asteroid", readHazardous},
+        {"close_approach_data", readCloseApproaches},
+    });
+    table.extract(neo, fields);
+}
+
+bool parse_numeric_id(string_view text, uint64_t& id) {
+    if (text.empty() || text.size() > 18 || (text[0] == '0' && text.size() > 1)) {
+        return false;
+    }
+    auto result = from_chars(text.data(), text.data() + text.size(), id);
+    return result.ec == errc() && result.ptr == text.data() + text.size();
+}
@@ -0,0 +1,56 @@
+// src/neo_fields.h
+
+#ifndef NEO_FIELDS_H
+#define NEO_FIELDS_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "json.hpp"
+#include "neo_dates.h"
+#include "small_vector.h"
+
+using namespace std;
+using json = nlohmann::json;
+
+// Struct to represent Close Approach Data
+struct CloseApproachData {
+    NeoDate date;
+    double relative_velocity;          // in km/s
+    double miss_distance;              // in km; Asteroid replaces it with BodyPhysics::effectiveMissDistance
+    int64_t epochMs = 0;               // Time of closest approach, ms since 1970-01-01 UTC
+    double reported_miss_distance = 0; // in km, as NeoWs reported it, never adjusted
+};
+
+// Close approaches of one asteroid; nearly all have exactly one, kept inline
+using CloseApproachList = SmallVector<CloseApproachData, 1>;
+
+// The values of one NeoWs object that an Asteroid is built from
+struct NeoFields {
+    string id;
+    string name;
+    string nasaJplUrl;
+    double absoluteMagnitude = 0;
+    double minDiameterKm = 0;
+    double maxDiameterKm = 0;
+    bool potentiallyHazardous = false;
+    CloseApproachList closeApproaches; // Miss distances as reported, in km
+};
+
+// Fills fields from a NeoWs object in a single pass.
+// A close approach's epochMs comes from epoch_date_close_approach, else from
+// close_approach_date_full, else is midnight of close_approach_date.
+// Each object is walked once against a precompiled field table; values are
+// read in place, so no json subtree is copied. Unknown keys are ignored.
+// Throws out_of_range naming the first missing field (for example
+// "estimated_diameter.kilometers.estimated_diameter_min") and
+// invalid_argument when a field has the wrong type, a string-encoded
+// number is malformed (see decode_number) or a date is not YYYY-MM-DD.
+void extract_neo_fields(const json& neo, NeoFields& fields);
+
+// Reads a NeoWs id such as "2154229" as a number. Returns false for anything
+// that would not print back the same way: signs, leading zeros, trailing
+// characters or more than 18 digits.
+bool parse_numeric_id(string_view text, uint64_t& id);
+
+#endif // NEO_FIELDS_H
@@ -0,0 +1,114 @@
+// src/neo_numbers.cpp
+
+#include "neo_numbers.h"
+#include <charconv>
+#include <cmath>
+
+namespace {
+
+struct UnitField {
+    const char* key;
+    double ApproachNumbers::*member;
+};
+
+struct UnitGroup {
+    const char* key;
+    const UnitField* units;
+    size_t unitCount;
+};
+
+const UnitField velocityUnits[] = {
+    {"kilometers_per_second", &ApproachNumbers::velocityKmPerS},
+    {"kilometers_per_hour", &ApproachNumbers::velocityKmPerH},
+    {"miles_per_hour", &ApproachNumbers::velocityMilesPerH},
+};
+
+const UnitField missDistanceUnits[] = {
+    {"astronomical", &ApproachNumbers::missAstronomical},
+    {"lunar", &ApproachNumbers::missLunar},
+    {"kilometers", &ApproachNumbers::missKm},
+    {"miles", &ApproachNumbers::missMiles},
+};
+
+const UnitGroup unitGroups[] = {
+    {"relative_velocity", velocityUnits, sizeof(velocityUnits) / sizeof(velocityUnits[0])},
+    {"miss_distance", missDistanceUnits, sizeof(missDistanceUnits) / sizeof(missDistanceUnits[0])},
+};
+
+bool fail(NumberError* error, size_t record, const string& field, const json* value, const char* reason) {
+    if (error) {
+        error->record = record;
+        error->field = field;
+        error->text = value && value->is_string() ? value->get_ref<const string&>() : string();
+        error->reason = reason;
+    }
+    return false;
+}
+
+} // namespace
+
+// Function to decode one string-encoded NeoWs number
+bool decode_number(string_view text, double& value, const char** reason) {
+    const char* why = nullptr;
+    double parsed = 0;
+    if (text.empty()) {
+        why = "is empty";
+    } else {
+        const char* end = text.data() + text.size();
+        auto result = from_chars(text.data(), end, parsed, chars_format::fixed | chars_format::scientific);
+        if (result.ec == errc::result_out_of_range) {
+            why = "is out of range";
+        } else if (result.ec != errc()) {
+            why = "is not a number";
+        } else if (result.ptr != end) {
+            why = "has trailing characters";
+        } else if (!isfinite(parsed)) {
+            why = "is not finite";
+        }
+    }
+    if (why) {
+        if (reason) *reason = why;
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+// Function to decode all units of a close_approach_data array
+bool decode_close_approaches(const json& closeApproachData, vector<ApproachNumbers>& numbers, NumberError* error) {
+    if (!closeApproachData.is_array()) {
+        return fail(error, 0, "close_approach_data", nullptr, "is not an array");
+    }
+    numbers.reserve(numbers.size() + closeApproachData.size());
+
+    size_t record = 0;
+    for (const auto& approach : closeApproachData) {
+        ApproachNumbers decoded;
+        for (const auto& group : unitGroups) {
+            auto groupValue = approach.find(group.key);
+            if (groupValue == approach.end()) {
+                return fail(error, record, group.key, nullptr, "is missing");
+            }
+            if (!groupValue->is_object()) {
+                return fail(error, record, group.key, nullptr, "is not an object");
+            }
+            for (size_t i = 0; i < group.unitCount; i++) {
+                const UnitField& unit = group.units[i];
+                auto value = groupValue->find(unit.key);
+                if (value == groupValue->end()) {
+                    return fail(error, record, string(group.key) + "." + unit.key, nullptr, "is missing");
+                }
+                if (!value->is_string()) {
+                    return fail(error, record, string(group.key) + "." + unit.key, nullptr, "is not a string");
+                }
+                const char* reason = nullptr;
+                if (!decode_number(value->get_ref<const string&>(), decoded.*unit.member, &reason)) {
+                    return fail(error, record, string(group.key) + "." + unit.key, &*value, reason);
+                }
+            }
+        }
+        numbers.push_back(decoded);
+        record++;
+    }
+    return true;
+}
@@ -0,0 +1,48 @@
+// src/neo_numbers.h
+
+#ifndef NEO_NUMBERS_H
+#define NEO_NUMBERS_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "json.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+// Every unit NeoWs reports a close approach in
+struct ApproachNumbers {
+    double velocityKmPerS;
+    double velocityKmPerH;
+    double velocityMilesPerH;
+    double missAstronomical; // au
+    double missLunar;        // Earth-Moon distances
+    double missKm;
+    double missMiles;
+};
+
+// Why a value could not be decoded, and where it was
+struct NumberError {
+    size_t record = 0; // Index of the close approach within the batch
+    string field;      // For example "miss_distance.lunar"
+    string text;       // The value as sent, empty if it was missing or not a string
+    string reason;
+};
+
+// Strictly decodes a number NeoWs sent as a string, such as "19.7506484939".
+// Uses from_chars, so it does not allocate and does not depend on the C
+// locale. The whole text must be one finite decimal number: no whitespace,
+// no leading '+', no trailing characters, no "inf" or "nan". On failure value
+// is left unchanged and reason (if given) says what was wrong.
+bool decode_number(string_view text, double& value, const char** reason = nullptr);
+
+// Decodes every unit of every entry of a close_approach_data array,
+// appending one ApproachNumbers per entry. Values are parsed straight from
+// the strings held by the json, without copying them.
+// Stops at the first missing or malformed value; numbers then keeps the
+// entries decoded before it and error describes the failure.
+bool decode_close_approaches(const json& closeApproachData, vector<ApproachNumbers>& numbers,
+                             NumberError* error = nullptr);
+
+#endif // NEO_NUMBERS_H
@@ -0,0 +1,150 @@
+// src/neo_snapshot.cpp
+
+#include "neo_snapshot.h"
+#include "neo_dates.h"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+using namespace NeoSnapshotFormat;
+
+namespace {
+
+// Shortest text that reads back as the same double
+string formatNumber(double value) {
+    char buffer[32];
+    auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+    return string(buffer, result.ptr);
+}
+
+// Whether a string lies inside a heap of heapSize bytes
+bool validRef(StringRef ref, uint64_t heapSize) {
+    return uint64_t(ref.offset) + ref.length <= heapSize;
+}
+
+} // namespace
+
+NeoSnapshot::NeoSnapshot()
+    : asteroidCount(0), totalApproaches(0), ids(nullptr), feedDates(nullptr), nameRefs(nullptr),
+      urlRefs(nullptr), minDiameters(nullptr), maxDiameters(nullptr), magnitudes(nullptr),
+      hazardous(nullptr), approachOffsets(nullptr), velocities(nullptr), missDistances(nullptr),
+      epochs(nullptr), stringHeap(nullptr) {}
+
+bool NeoSnapshot::open(const string& filename) {
+    asteroidCount = 0;
+    totalApproaches = 0;
+    if (!file.open(filename)) {
+        return false;
+    }
+    if (file.size() < sizeof(SnapshotHeader)) {
+        cerr << "Snapshot " << filename << " is truncated." << endl;
+        file.close();
+        return false;
+    }
+
+    SnapshotHeader header;
+    memcpy(&header, file.data(), sizeof(header));
+    if (memcmp(header.magic, magic, sizeof(magic)) != 0 || header.byteOrder != byteOrderMark) {
+        cerr << filename << " is not a NEO snapshot for this platform." << endl;
+        file.close();
+        return false;
+    }
+    if (header.version != version) {
+        cerr << "Snapshot " << filename << " has version " << header.version
+             << ", expected " << version << "." << endl;
+        file.close();
+        return false;
+    }
+
+    // Every column must be aligned and lie inside the file. Each row takes
+    // more than one byte, so counts larger than the file are corrupt, and
+    // rejecting them first keeps the byte sizes below from overflowing.
+    const uint64_t n = header.asteroidCount;
+    const uint64_t m = header.approachCount;
+    if (n > file.size() || m > file.size() || m > UINT32_MAX) {
+        cerr << "Snapshot " << filename << " is corrupt." << endl;
+        file.close();
+        return false;
+    }
+    const uint64_t columnBytes[ColumnCount] = {
+        n * sizeof(uint64_t), n * sizeof(StringRef), n * sizeof(StringRef), n * sizeof(StringRef),
+        n * sizeof(double), n * sizeof(double), n * sizeof(double), n * sizeof(uint8_t),
+        (n + 1) * sizeof(uint32_t), m * sizeof(double), m * sizeof(double), m * sizeof(int64_t),
+        header.stringHeapSize
+    };
+    for (int column = 0; column < ColumnCount; column++) {
+        uint64_t offset = header.columnOffsets[column];
+        if (offset % 8 != 0 || offset > file.size() || columnBytes[column] > file.size() - offset) {
+            cerr << "Snapshot " << filename << " is truncated." << endl;
+            file.close();
+            return false;
+        }
+    }
+
+    const char* base = file.data();
+    ids = reinterpret_cast<const uint64_t*>(base + header.columnOffsets[Ids]);
+    feedDates = reinterpret_cast<const StringRef*>(base + header.columnOffsets[FeedDates]);
+    nameRefs = reinterpret_cast<const StringRef*>(base + header.columnOffsets[NameRefs]);
+    urlRefs = reinterpret_cast<const StringRef*>(base + header.columnOffsets[UrlRefs]);
+    minDiameters = reinterpret_cast<const double*>(base + header.columnOffsets[MinDiameters]);
+    maxDiameters = reinterpret_cast<const double*>(base + header.columnOffsets[MaxDiameters]);
+    magnitudes = reinterpret_cast<const double*>(base + header.columnOffsets[Magnitudes]);
+    hazardous = reinterpret_cast<const uint8_t*>(base + header.columnOffsets[Hazardous]);
+    approachOffsets = reinterpret_cast<const uint32_t*>(base + header.columnOffsets[ApproachBegin]);
+    velocities = reinterpret_cast<const double*>(base + header.columnOffsets[Velocities]);
+    missDistances = reinterpret_cast<const double*>(base + header.columnOffsets[MissDistances]);
+    epochs = reinterpret_cast<const int64_t*>(base + header.columnOffsets[Epochs]);
+    stringHeap = base + header.columnOffsets[StringHeap];
+
+    // Checked once here so the accessors can index without bounds checks
+    bool valid = approachOffsets[0] == 0 && approachOffsets[n] == m;
+    for (uint64_t i = 0; valid && i < n; i++) {
+        valid = approachOffsets[i] <= approachOffsets[i + 1] && validRef(feedDates[i], header.stringHeapSize) &&
+                validRef(nameRefs[i], header.stringHeapSize) && validRef(urlRefs[i], header.stringHeapSize);
+    }
+    if (!valid) {
+        cerr << "Snapshot " << filename << " is corrupt." << endl;
+        file.close();
+        return false;
+    }
+    asteroidCount = n;
+    totalApproaches = m;
+    return true;
+}
+
+json NeoSnapshot::feedForDate(const string& date) const {
+    json neos = json::array();
+    for (size_t i = 0; i < asteroidCount; i++) {
+        if (feedDate(i) != date) continue;
+
+        json approaches = json::array();
+        for (uint32_t a = approachBegin(i); a < approachEnd(i); a++) {
+            approaches.push_back({
+                {"close_approach_date", NeoDates::formatDate(NeoDates::daysFromEpochMs(epochs[a]))},
+                {"epoch_date_close_approach", epochs[a]},
+                {"relative_velocity", {{"kilometers_per_second", formatNumber(velocities[a])}}},
+                {"miss_distance", {{"kilometers", formatNumber(missDistances[a])}}}
+            });
+        }
+        neos.push_back({
+            {"id", to_string(ids[i])},
+            {"name", string(name(i))},
+            {"nasa_jpl_url", string(nasaJplUrl(i))},
+            {"absolute_magnitude_h", magnitudes[i]},
+            {"estimated_diameter", {{"kilometers", {
+                {"estimated_diameter_min", minDiameters[i]},
+                {"estimated_diameter_max", maxDiameters[i]}
+            }}}},
+            {"is_potentially_hazardous_asteroid", isHazardous(i)},
+            {"close_approach_data", approaches}
+        });
+    }
+
+    json feed = {{"near_earth_objects", json::object()}};
+    if (!neos.empty()) {
+        feed["element_count"] = neos.size();
+        feed["near_earth_objects"][date] = neos;
+    }
+    return feed;
+}
@@ -0,0 +1,125 @@
+// src/neo_snapshot.h
+
+#ifndef NEO_SNAPSHOT_H
+#define NEO_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "mapped_file.h"
+#include "platform_config.h"
+
+using namespace std;
+using json = nlohmann::json;
+
+// Binary snapshot of a NeoWs feed, stored as one column per field.
+//
+// File layout (native byte order, every column 8-byte aligned):
+//   SnapshotHeader
+//   per asteroid:  ids, feedDates, nameRefs, urlRefs, minDiameters, maxDiameters,
+//                  magnitudes, hazardous, approachBegin (count + 1 offsets)
+//   per approach:  velocities (km/s), missDistances (km, as published), epochs (ms)
+//   stringHeap:    names, URLs and feed dates, referenced by offset and length
+//
+// The approaches of asteroid i are [approachBegin[i], approachBegin[i + 1]).
+// A snapshot is opened with mmap and used in place, nothing is parsed.
+
+namespace NeoSnapshotFormat {
+    const char magic[8] = {'N', 'E', 'O', 'S', 'N', 'A', 'P', '\0'};
+    const uint32_t version = 1;
+    const uint32_t byteOrderMark = 0x01020304;
+
+    enum Column {
+        Ids,
+        FeedDates,
+        NameRefs,
+        UrlRefs,
+        MinDiameters,
+        MaxDiameters,
+        Magnitudes,
+        Hazardous,
+        ApproachBegin,
+        Velocities,
+        MissDistances,
+        Epochs,
+        StringHeap,
+        ColumnCount
+    };
+}
+
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t asteroidCount;
+    uint64_t approachCount;
+    uint64_t stringHeapSize;
+    uint64_t columnOffsets[NeoSnapshotFormat::ColumnCount];
+};
+
+// Read-only view of a snapshot file
+class NeoSnapshot {
+public:
+    NeoSnapshot();
+
+    // Maps and validates the file, returns false if it is missing or not a valid snapshot
+    bool open(const string& filename);
+
+    size_t size() const { return asteroidCount; }
+    size_t approachCount() const { return totalApproaches; }
+
+    uint64_t id(size_t i) const { return ids[i]; }
+    string_view name(size_t i) const { return text(nameRefs[i]); }
+    string_view nasaJplUrl(size_t i) const { return text(urlRefs[i]); }
+    string_view feedDate(size_t i) const { return text(feedDates[i]); }
+    double minDiameterKm(size_t i) const { return minDiameters[i]; }
+    double maxDiameterKm(size_t i) const { return maxDiameters[i]; }
+    double absoluteMagnitude(size_t i) const { return magnitudes[i]; }
+    bool isHazardous(size_t i) const { return hazardous[i] != 0; }
+
+    uint32_t approachBegin(size_t i) const { return approachOffsets[i]; }
+    uint32_t approachEnd(size_t i) const { return approachOffsets[i + 1]; }
+    double velocityKmPerS(size_t approach) const { return velocities[approach]; }
+    double missDistanceKm(size_t approach) const { return missDistances[approach]; }
+    int64_t epochMs(size_t approach) const { return epochs[approach]; }
+
+    // Rebuilds the NEOs of one feed date in the NeoWs layout, so the result
+    // can go through process_neo_data and the Asteroid constructor
+    json feedForDate(const string& date) const;
+
+private:
+    MappedFile file;
+    size_t asteroidCount;
+    size_t totalApproaches;
+    const uint64_t* ids;
+    const StringRef* feedDates;
+    const StringRef* nameRefs;
+    const StringRef* urlRefs;
+    const double* minDiameters;
+    const double* maxDiameters;
+    const double* magnitudes;
+    const uint8_t* hazardous;
+    const uint32_t* approachOffsets;
+    const double* velocities;
+    const double* missDistances;
+    const int64_t* epochs;
+    const char* stringHeap;
+
+    string_view text(StringRef ref) const { return string_view(stringHeap + ref.offset, ref.length); }
+};
+
+// Converts a NeoWs feed file (the format load_from_file reads) into a snapshot.
+// The feed is streamed, so only the columns are held in memory. Records are
+// read with extract_neo_fields, so rows hold what an Asteroid is built from;
+// records it rejects, or whose id is not a plain number, are reported and
+// skipped.
+// Defined in neo_snapshot_writer.cpp, which also needs the streaming loader;
+// readers only need neo_snapshot.cpp and mapped_file.cpp.
+bool write_snapshot(const string& feedFilename, const string& snapshotFilename);
+
+#endif // NEO_SNAPSHOT_H
@@ -0,0 +1,176 @@
+// src/neo_snapshot_writer.cpp
+
+#include "neo_snapshot.h"
+#include "neo_fields.h"
+#include "neo_stream.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+using namespace NeoSnapshotFormat;
+
+namespace {
+
+// Column buffers filled while the feed is streamed
+struct SnapshotColumns {
+    vector<uint64_t> ids;
+    vector<StringRef> feedDates;
+    vector<StringRef> nameRefs;
+    vector<StringRef> urlRefs;
+    vector<double> minDiameters;
+    vector<double> maxDiameters;
+    vector<double> magnitudes;
+    vector<uint8_t> hazardous;
+    vector<uint32_t> approachBegin{0};
+    vector<double> velocities;
+    vector<double> missDistances;
+    vector<int64_t> epochs;
+    string stringHeap;
+    unordered_map<string, StringRef> internedDates;
+
+    StringRef addString(const string& value) {
+        if (stringHeap.size() + value.size() > UINT32_MAX) {
+            throw length_error("Snapshot string heap exceeds 4 GB");
+        }
+        StringRef ref{static_cast<uint32_t>(stringHeap.size()), static_cast<uint32_t>(value.size())};
+        stringHeap += value;
+        return ref;
+    }
+
+    StringRef addDate(const string& date) {
+        auto found = internedDates.find(date);
+        if (found != internedDates.end()) return found->second;
+        StringRef ref = addString(date);
+        internedDates.emplace(date, ref);
+        return ref;
+    }
+
+    // Appends one NEO. Everything is checked before anything is stored, so
+    // a record that throws leaves the columns untouched.
+    void add(const string& date, const NeoFields& fields) {
+        uint64_t id;
+        if (!parse_numeric_id(fields.id, id)) {
+            throw invalid_argument("Id is not a plain number: " + fields.id);
+        }
+        if (velocities.size() + fields.closeApproaches.size() > UINT32_MAX) {
+            throw length_error("Snapshot holds at most 2^32 close approaches");
+        }
+
+        ids.push_back(id);
+        feedDates.push_back(addDate(date));
+        nameRefs.push_back(addString(fields.name));
+        urlRefs.push_back(addString(fields.nasaJplUrl));
+        minDiameters.push_back(fields.minDiameterKm);
+        maxDiameters.push_back(fields.maxDiameterKm);
+        magnitudes.push_back(fields.absoluteMagnitude);
+        hazardous.push_back(fields.potentiallyHazardous ? 1 : 0);
+        for (const auto& approach : fields.closeApproaches) {
+            velocities.push_back(approach.relative_velocity);
+            missDistances.push_back(approach.miss_distance);
+            epochs.push_back(approach.epochMs);
+        }
+        approachBegin.push_back(static_cast<uint32_t>(velocities.size()));
+    }
+};
+
+uint64_t alignTo8(uint64_t offset) {
+    return (offset + 7) & ~uint64_t(7);
+}
+
+// Writes columns back to back after the header, padding each to 8 bytes
+class ColumnWriter {
+public:
+    ColumnWriter(ofstream& out, SnapshotHeader& header)
+        : out(out), header(header), position(sizeof(SnapshotHeader)) {}
+
+    void write(Column column, const void* data, size_t bytes) {
+        static const char padding[8] = {};
+        uint64_t aligned = alignTo8(position);
+        out.write(padding, static_cast<streamsize>(aligned - position));
+        header.columnOffsets[column] = aligned;
+        out.write(static_cast<const char*>(data), static_cast<streamsize>(bytes));
+        position = aligned + bytes;
+    }
+
+    template <typename T>
+    void write(Column column, const vector<T>& values) {
+        write(column, values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    ofstream& out;
+    SnapshotHeader& header;
+    uint64_t position;
+};
+
+} // namespace
+
+// Function to convert a NeoWs feed file into a columnar snapshot
+bool write_snapshot(const string& feedFilename, const string& snapshotFilename) {
+    // Fields are read with extract_neo_fields, like every other loader, so a
+    // snapshot row holds exactly what an Asteroid would be built from
+    SnapshotColumns columns;
+    NeoFields fields;
+    bool parsed = stream_records_from_file(feedFilename, [&](const string& date, const json& neo) {
+        try {
+            extract_neo_fields(neo, fields);
+            columns.add(date, fields);
+        } catch (const exception& e) {
+            cerr << "Skipping NEO record for " << date << ": " << e.what() << endl;
+        }
+    });
+    if (!parsed) {
+        return false;
+    }
+
+    SnapshotHeader header = {};
+    memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.byteOrder = byteOrderMark;
+    header.asteroidCount = columns.ids.size();
+    header.approachCount = columns.velocities.size();
+    header.stringHeapSize = columns.stringHeap.size();
+
+    // Write next to the target and rename, so readers never see a partial file
+    string tempFilename = snapshotFilename + ".tmp";
+    ofstream out(tempFilename, ios::binary | ios::trunc);
+    if (!out.is_open()) {
+        cerr << "Could not create snapshot " << tempFilename << endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ColumnWriter writer(out, header);
+    writer.write(Ids, columns.ids);
+    writer.write(FeedDates, columns.feedDates);
+    writer.write(NameRefs, columns.nameRefs);
+    writer.write(UrlRefs, columns.urlRefs);
+    writer.write(MinDiameters, columns.minDiameters);
+    writer.write(MaxDiameters, columns.maxDiameters);
+    writer.write(Magnitudes, columns.magnitudes);
+    writer.write(Hazardous, columns.hazardous);
+    writer.write(ApproachBegin, columns.approachBegin);
+    writer.write(Velocities, columns.velocities);
+    writer.write(MissDistances, columns.missDistances);
+    writer.write(Epochs, columns.epochs);
+    writer.write(StringHeap, columns.stringHeap.data(), columns.stringHeap.size());
+
+    // Column offsets are known now, rewrite the header with them
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (!out) {
+        cerr << "Failed to write snapshot " << tempFilename << endl;
+        remove(tempFilename.c_str());
+        return false;
+    }
+    if (rename(tempFilename.c_str(), snapshotFilename.c_str()) != 0) {
+        cerr << "Could not replace snapshot " << snapshotFilename << endl;
+        remove(tempFilename.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,179 @@
+// src/neo_stream.cpp
+
+#include "neo_stream.h"
+#include "mapped_file.h"
+
+namespace {
+
+// SAX handler that only materializes the NEO object currently being read.
+// Layout of a NeoWs feed:
+//   { "near_earth_objects": { "<date>": [ { ...neo... }, ... ], ... }, ... }
+// Everything outside near_earth_objects (links, element_count) is skipped
+// without being stored.
+class NeoSaxHandler {
+public:
+    explicit NeoSaxHandler(const NeoRecordHandler& onRecord)
+        : onRecord(onRecord), depth(0), inFeed(false), inDateList(false) {}
+
+    bool null() { return addValue(nullptr); }
+    bool boolean(bool val) { return addValue(val); }
+    bool number_integer(json::number_integer_t val) { return addValue(val); }
+    bool number_unsigned(json::number_unsigned_t val) { return addValue(val); }
+    bool number_float(json::number_float_t val, const json::string_t&) { return addValue(val); }
+    bool string(json::string_t& val) { return addValue(std::move(val)); }
+    bool binary(json::binary_t& val) { return addValue(std::move(val)); }
+
+    bool start_object(size_t) {
+        if (!stack.empty()) {
+            stack.push_back(insert(json::object()));
+            return true;
+        }
+        if (inDateList && depth == 3) {
+            record = json::object();
+            stack.push_back(&record);
+            return true;
+        }
+        depth++;
+        if (depth == 2 && rootKey == "near_earth_objects") {
+            inFeed = true;
+        }
+        return true;
+    }
+
+    bool end_object() {
+        if (!stack.empty()) {
+            stack.pop_back();
+            if (stack.empty()) {
+                emitRecord();
+            }
+            return true;
+        }
+        leaveContainer();
+        return true;
+    }
+
+    bool start_array(size_t) {
+        if (!stack.empty()) {
+            stack.push_back(insert(json::array()));
+            return true;
+        }
+        depth++;
+        if (depth == 3 && inFeed) {
+            inDateList = true;
+        }
+        return true;
+    }
+
+    bool end_array() {
+        if (!stack.empty()) {
+            stack.pop_back();
+            return true;
+        }
+        leaveContainer();
+        return true;
+    }
+
+    bool key(json::string_t& val) {
+        if (!stack.empty()) {
+            pendingKey = std::move(val);
+        } else if (depth == 1) {
+            rootKey = val;
+        } else if (depth == 2 && inFeed) {
+            currentDate = val;
+        }
+        return true;
+    }
+
+    bool parse_error(size_t, const std::string&, const nlohmann::detail::exception& ex) {
+        cerr << "Error parsing NEO feed: " << ex.what() << endl;
+        return false;
+    }
+
+private:
+    const NeoRecordHandler& onRecord;
+    int depth;            // Containers opened outside of the NEO being captured
+    bool inFeed;          // Inside the near_earth_objects map
+    bool inDateList;      // Inside the array of NEOs for currentDate
+    std::string rootKey;
+    std::string currentDate;
+
+    json record;          // NEO currently being captured
+    vector<json*> stack;  // Open containers inside record
+    std::string pendingKey;
+
+    template <typename Value>
+    bool addValue(Value&& val) {
+        if (!stack.empty()) {
+            insert(json(std::forward<Value>(val)));
+        }
+        return true;
+    }
+
+    json* insert(json&& val) {
+        json* parent = stack.back();
+        if (parent->is_object()) {
+            json& slot = (*parent)[pendingKey];
+            slot = std::move(val);
+            return &slot;
+        }
+        parent->push_back(std::move(val));
+        return &parent->back();
+    }
+
+    void leaveContainer() {
+        depth--;
+        if (depth < 3) inDateList = false;
+        if (depth < 2) inFeed = false;
+    }
+
+    void emitRecord() {
+        onRecord(currentDate, record);
+        record = nullptr;
+    }
+};
+
+// Builds an Asteroid for every record, skipping the ones that are incomplete
+NeoRecordHandler asteroidRecordHandler(const AsteroidHandler& onAsteroid) {
+    return [&onAsteroid](const string& date, const json& neo) {
+        bool built = false;
+        try {
+            Asteroid asteroid(neo);
+            built = true;
+            onAsteroid(date, asteroid);
+        } catch (const exception& e) {
+            if (built) {
+                throw; // The handler's own errors are not a bad record
+            }
+            cerr << "Skipping NEO record for " << date << ": " << e.what() << endl;
+        }
+    };
+}
+
+bool streamMapped(const string& filename, const NeoRecordHandler& onRecord) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        cerr << "Could not open the file!" << endl;
+        return false;
+    }
+    NeoSaxHandler handler(onRecord);
+    return json::sax_parse(file.begin(), file.end(), &handler);
+}
+
+} // namespace
+
+// Function to stream NEO records from any input stream
+bool stream_neo_data(istream& input, const AsteroidHandler& onAsteroid) {
+    NeoRecordHandler onRecord = asteroidRecordHandler(onAsteroid);
+    NeoSaxHandler handler(onRecord);
+    return json::sax_parse(input, &handler);
+}
+
+// Function to stream NEO records from a local JSON file
+bool stream_from_file(const string& filename, const AsteroidHandler& onAsteroid) {
+    return streamMapped(filename, asteroidRecordHandler(onAsteroid));
+}
+
+// Function to stream raw NEO objects from a local JSON file
+bool stream_records_from_file(const string& filename, const NeoRecordHandler& onRecord) {
+    return streamMapped(filename, onRecord);
+}
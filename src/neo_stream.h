@@ -0,0 +1,29 @@
+// src/neo_stream.h
+
+#ifndef NEO_STREAM_H
+#define NEO_STREAM_H
+
+#include <functional>
+#include <istream>
+#include <string>
+#include "classes.h"
+
+// Called once for every NEO in a feed, together with the date it is listed under
+using AsteroidHandler = function<void(const string& date, const Asteroid& asteroid)>;
+
+// Same as AsteroidHandler, for callers that want the raw NeoWs object
+using NeoRecordHandler = function<void(const string& date, const json& neo)>;
+
+// Streams a NeoWs feed through the SAX parser and hands each NEO to the callback
+// as soon as its closing brace is read. Only one NEO is held in memory at a time,
+// so memory use does not grow with the size of the feed.
+// Records that cannot be turned into an Asteroid are reported and skipped.
+bool stream_neo_data(istream& input, const AsteroidHandler& onAsteroid);
+
+// Same as stream_neo_data, reading from a local JSON file
+bool stream_from_file(const string& filename, const AsteroidHandler& onAsteroid);
+
+// Streams the raw NEO objects of a local JSON file, one at a time
+bool stream_records_from_file(const string& filename, const NeoRecordHandler& onRecord);
+
+#endif // NEO_STREAM_H
@@ -0,0 +1,41 @@
+// src/parallel.h
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Runs work(index) for every index in [0, count), spread over threadCount
+// threads (0 means one per hardware thread). Indices are handed out one at a
+// time from a shared counter, so uneven tasks balance themselves, and the
+// calling thread works too. Returns once every index is done.
+template <typename Work>
+void parallel_for(size_t count, unsigned threadCount, Work work) {
+    if (threadCount == 0) {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+    size_t workerCount = min<size_t>(threadCount, count);
+    atomic<size_t> nextIndex(0);
+    auto worker = [&] {
+        for (size_t index; (index = nextIndex++) < count;) {
+            work(index);
+        }
+    };
+
+    vector<thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& workerThread : workers) {
+        workerThread.join();
+    }
+}
+
+#endif // PARALLEL_H
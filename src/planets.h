@@ -3,30 +3,64 @@
 #ifndef PLANETS_H
 #define PLANETS_H
 
-#include <vector>
-#include <string>
+#include <array>
+#include <string_view>
+#include "body_physics.h"
 
 using namespace std;
 
 // Struct to hold planet data
 struct PlanetData {
-    string name;
-    double diameter; // in kilometers
-    double mass;     // in kilograms
+    string_view name;
+    double diameter;       // in kilometers
+    double mass;           // in kilograms
+    double surfaceGravity; // in m/s^2
+    double escapeVelocity; // in km/s
 };
 
 namespace SolarSystem {
-    // Predefined data for planets
-    const vector<PlanetData> predefinedPlanets = {
-        {"Mercury", 4879.4, 3.3011e23},
-        {"Venus", 12104, 4.8675e24},
-        {"Earth", 12742, 5.97237e24},
-        {"Mars", 6779, 6.4171e23},
-        {"Jupiter", 139820, 1.8982e27},
-        {"Saturn", 116460, 5.6834e26},
-        {"Uranus", 50724, 8.6810e25},
-        {"Neptune", 49244, 1.02413e26},
-    };
+    // A planet with its derived quantities, computed at compile time
+    constexpr PlanetData planet(string_view name, double diameter, double mass) {
+        return {name, diameter, mass, BodyPhysics::surfaceGravity(diameter, mass),
+                BodyPhysics::compileTimeEscapeVelocity(diameter, mass)};
+    }
+
+    // Predefined data for planets, built entirely at compile time: no
+    // allocation and no static initialization at startup
+    inline constexpr array<PlanetData, 8> predefinedPlanets = {{
+        planet("Mercury", 4879.4, 3.3011e23),
+        planet("Venus", 12104, 4.8675e24),
+        planet("Earth", 12742, 5.97237e24),
+        planet("Mars", 6779, 6.4171e23),
+        planet("Jupiter", 139820, 1.8982e27),
+        planet("Saturn", 116460, 5.6834e26),
+        planet("Uranus", 50724, 8.6810e25),
+        planet("Neptune", 49244, 1.02413e26),
+    }};
+
+    // The two derived quantities agree with each other: v^2 = 2 g r
+    constexpr bool consistent(const PlanetData& planet) {
+        double radiusMeters = planet.diameter * 1000 / 2.0;
+        double velocity = planet.escapeVelocity * 1000;
+        double relation = velocity * velocity / (2 * planet.surfaceGravity * radiusMeters);
+        return planet.diameter > 0 && planet.mass > 0 && relation > 1 - 1e-12 && relation < 1 + 1e-12;
+    }
+
+    constexpr bool allConsistent() {
+        for (const auto& planet : predefinedPlanets) {
+            if (!consistent(planet)) return false;
+        }
+        return true;
+    }
+
+    static_assert(allConsistent(), "Planet gravity and escape velocity disagree");
+    static_assert(predefinedPlanets[2].name == "Earth", "Earth is the third planet");
+    static_assert(predefinedPlanets[2].surfaceGravity > 9.81 && predefinedPlanets[2].surfaceGravity < 9.83,
+                  "Earth's surface gravity is about 9.82 m/s^2");
+    static_assert(predefinedPlanets[2].escapeVelocity > 11.18 && predefinedPlanets[2].escapeVelocity < 11.19,
+                  "Earth's escape velocity is about 11.19 km/s");
+    static_assert(predefinedPlanets[4].surfaceGravity > 25 && predefinedPlanets[4].escapeVelocity > 59,
+                  "Jupiter's gravity is about 25.9 m/s^2 and its escape velocity 60 km/s");
 }
 
-#endif 
+#endif
@@ -0,0 +1,189 @@
+// src/response_cache.cpp
+
+#include "response_cache.h"
+#include "neo_dates.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// FNV-1a, enough to keep endpoints apart in file names
+uint64_t hashKey(const string& key) {
+    uint64_t hash = 1469598103934665603ull;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Temporary files older than this were left by a writer that died before
+// renaming them; younger ones may still be in use
+const auto staleTempAge = chrono::minutes(1);
+
+bool isEntry(const fs::directory_entry& entry) {
+    return entry.is_regular_file() && entry.path().extension() == ".json";
+}
+
+// Entry being written by store(), named <entry>.json.tmp<random>
+bool isTempFile(const fs::directory_entry& entry) {
+    return entry.is_regular_file() && entry.path().filename().string().find(".json.tmp") != string::npos;
+}
+
+} // namespace
+
+ResponseCache::ResponseCache(ResponseCacheOptions options)
+    : options(std::move(options)) {}
+
+string ResponseCache::entryPath(const string& endpoint, const string& startDate, const string& endDate) const {
+    char hash[17];
+    snprintf(hash, sizeof(hash), "%016llx",
+             static_cast<unsigned long long>(hashKey(endpoint + "\n" + startDate + "\n" + endDate)));
+    return (fs::path(options.directory) / (startDate + "_" + endDate + "_" + hash + ".json")).string();
+}
+
+// Whether the range could still change when it was fetched at `when`
+bool ResponseCache::isRecent(const string& endDate, time_t when) const {
+    int64_t endDay = 0;
+    NeoDates::parseDate(endDate, endDay);
+    int64_t day = static_cast<int64_t>(when) / (NeoDates::msPerDay / 1000);
+    return endDay >= day - options.recentDays;
+}
+
+bool ResponseCache::lookup(const string& endpoint, const string& startDate, const string& endDate, string& body) {
+    int64_t day;
+    if (!NeoDates::parseDate(startDate, day) || !NeoDates::parseDate(endDate, day)) {
+        return false;
+    }
+    lock_guard<mutex> lock(cacheMutex);
+    string path = entryPath(endpoint, startDate, endDate);
+    ifstream file(path, ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // Entries start with the time they were fetched, on a line of its own
+    long long fetchedAt = 0;
+    if (!(file >> fetchedAt) || file.get() != '\n') {
+        file.close();
+        error_code ignored;
+        fs::remove(path, ignored);
+        return false;
+    }
+    if (isRecent(endDate, fetchedAt) && options.clock() - fetchedAt > options.recentTtlSeconds) {
+        file.close();
+        error_code ignored;
+        fs::remove(path, ignored);
+        return false;
+    }
+
+    ostringstream contents;
+    contents << file.rdbuf();
+    body = contents.str();
+
+    // Mark as recently used for eviction
+    error_code ignored;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ignored);
+    return true;
+}
+
+void ResponseCache::store(const string& endpoint, const string& startDate, const string& endDate, const string& body) {
+    int64_t day;
+    if (!NeoDates::parseDate(startDate, day) || !NeoDates::parseDate(endDate, day)) {
+        return;
+    }
+    lock_guard<mutex> lock(cacheMutex);
+    error_code error;
+    fs::create_directories(options.directory, error);
+    if (error) {
+        cerr << "Could not create cache directory " << options.directory << ": " << error.message() << endl;
+        return;
+    }
+
+    // Unique temporary name, so concurrent writers never share a file
+    string path = entryPath(endpoint, startDate, endDate);
+    static random_device entropy;
+    string tempPath = path + ".tmp" + to_string(entropy());
+    {
+        ofstream file(tempPath, ios::binary | ios::trunc);
+        file << static_cast<long long>(options.clock()) << '\n' << body;
+        if (!file) {
+            cerr << "Could not write cache entry " << tempPath << endl;
+            file.close();
+            fs::remove(tempPath, error);
+            return;
+        }
+    }
+    fs::rename(tempPath, path, error);
+    if (error) {
+        cerr << "Could not store cache entry " << path << ": " << error.message() << endl;
+        fs::remove(tempPath, error);
+        return;
+    }
+    evict();
+}
+
+uint64_t ResponseCache::sizeOnDisk() const {
+    uint64_t total = 0;
+    error_code error;
+    for (const auto& entry : fs::directory_iterator(options.directory, error)) {
+        if (!isEntry(entry) && !isTempFile(entry)) continue;
+        uint64_t size = entry.file_size(error);
+        if (!error) total += size;
+    }
+    return total;
+}
+
+// Removes stale temporary files, then least recently used entries until the
+// cache fits in maxBytes. Temporary files still being written count toward
+// the limit but are left alone.
+void ResponseCache::evict() {
+    struct Entry {
+        fs::path path;
+        uint64_t size;
+        fs::file_time_type lastUsed;
+    };
+    vector<Entry> entries;
+    uint64_t total = 0;
+    error_code error;
+    auto staleBefore = fs::file_time_type::clock::now() - staleTempAge;
+    for (const auto& entry : fs::directory_iterator(options.directory, error)) {
+        bool temporary = isTempFile(entry);
+        if (!temporary && !isEntry(entry)) continue;
+
+        // A file can vanish mid-scan, typically a temporary file a concurrent
+        // writer has just renamed; it takes no space any more
+        uint64_t size = entry.file_size(error);
+        if (error) continue;
+        fs::file_time_type lastWrite = entry.last_write_time(error);
+        if (error) continue;
+
+        if (temporary) {
+            if (lastWrite >= staleBefore || !fs::remove(entry.path(), error)) {
+                total += size;
+            }
+            continue;
+        }
+        entries.push_back({entry.path(), size, lastWrite});
+        total += size;
+    }
+    if (total <= options.maxBytes) {
+        return;
+    }
+
+    sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUsed < b.lastUsed; });
+    for (const auto& entry : entries) {
+        if (total <= options.maxBytes) break;
+        if (fs::remove(entry.path, error)) {
+            total -= entry.size;
+        }
+    }
+}
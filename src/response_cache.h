@@ -0,0 +1,51 @@
+// src/response_cache.h
+
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+
+using namespace std;
+
+struct ResponseCacheOptions {
+    string directory = ".neo_cache";
+    uint64_t maxBytes = 256ull * 1024 * 1024;   // Least recently used entries are evicted beyond this
+    int recentDays = 7;                         // Ranges ending this close to the fetch may still change...
+    long recentTtlSeconds = 6 * 60 * 60;        // ...so they are only trusted for this long
+    function<time_t()> clock = [] { return time(nullptr); };
+};
+
+// On-disk cache of API responses, keyed by endpoint and date range.
+// Responses for historical ranges never change and are kept until evicted.
+// A range that ended within recentDays of the time it was fetched may have
+// changed since, so that entry expires after recentTtlSeconds.
+// Entries are written to a temporary file and renamed into place, so a
+// crash or a concurrent reader never sees a partial response; temporary
+// files a crashed writer left behind are removed once they are a minute old.
+class ResponseCache {
+public:
+    explicit ResponseCache(ResponseCacheOptions options = ResponseCacheOptions());
+
+    // Fills body and returns true if a fresh entry exists
+    bool lookup(const string& endpoint, const string& startDate, const string& endDate, string& body);
+
+    // Stores a response, then evicts old entries if the cache is over its size limit
+    void store(const string& endpoint, const string& startDate, const string& endDate, const string& body);
+
+    // Total size of all entries and temporary files in bytes
+    uint64_t sizeOnDisk() const;
+
+private:
+    ResponseCacheOptions options;
+    mutex cacheMutex;
+
+    string entryPath(const string& endpoint, const string& startDate, const string& endDate) const;
+    bool isRecent(const string& endDate, time_t when) const;
+    void evict();
+};
+
+#endif // RESPONSE_CACHE_H
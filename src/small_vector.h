@@ -0,0 +1,167 @@
+// src/small_vector.h
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+
+using namespace std;
+
+// Vector that keeps up to N elements inside the object itself and only moves
+// to the heap beyond that. Used where almost every instance holds one or two
+// elements, such as the close approaches of an asteroid, so the common case
+// costs no allocation at all.
+// Elements must be trivially copyable, which lets growth, copies and moves
+// be plain memcpy.
+// Heap storage comes from a memory_resource, the default one unless given,
+// with the rules of the std::pmr containers: a copy uses the default
+// resource, a move keeps the source's, and assignment keeps the target's.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(is_trivially_copyable<T>::value, "SmallVector elements must be trivially copyable");
+    static_assert(N > 0, "SmallVector needs an inline capacity");
+
+public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    SmallVector() = default;
+    explicit SmallVector(pmr::memory_resource* resource) : memory(resource) {}
+    SmallVector(initializer_list<T> list) { assign(list.begin(), list.end()); }
+    SmallVector(const SmallVector& other) { assign(other.begin(), other.end()); }
+    SmallVector(SmallVector&& other) noexcept : memory(other.memory) { take(other); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) assign(other.begin(), other.end());
+        return *this;
+    }
+
+    // Heap storage changes hands only between vectors on the same resource;
+    // otherwise the elements are copied into this vector's resource
+    SmallVector& operator=(SmallVector&& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (*memory == *other.memory) {
+            release();
+            take(other);
+        } else {
+            assign(other.begin(), other.end());
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~SmallVector() { release(); }
+
+    T* begin() { return items; }
+    T* end() { return items + count; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + count; }
+    T* data() { return items; }
+    const T* data() const { return items; }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return limit; }
+    bool empty() const { return count == 0; }
+    bool isInline() const { return items == inlineItems(); }
+    pmr::memory_resource* resource() const { return memory; }
+
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+    T& front() { return items[0]; }
+    const T& front() const { return items[0]; }
+    T& back() { return items[count - 1]; }
+    const T& back() const { return items[count - 1]; }
+
+    void push_back(const T& value) {
+        T copy = value; // value may live in the storage that grow() frees
+        if (count == limit) grow(limit * 2);
+        new (items + count++) T(copy);
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        T value{std::forward<Args>(args)...};
+        if (count == limit) grow(limit * 2);
+        return *new (items + count++) T(value);
+    }
+
+    void pop_back() { count--; }
+    void clear() { count = 0; }
+
+    void reserve(size_t wanted) {
+        if (wanted > limit) grow(wanted);
+    }
+
+    // New elements are value-initialized
+    void resize(size_t wanted) {
+        reserve(wanted);
+        for (size_t i = count; i < wanted; i++) new (items + i) T();
+        count = static_cast<uint32_t>(wanted);
+    }
+
+    // Heap bytes held, 0 while the elements are inline
+    size_t heapBytes() const { return isInline() ? 0 : limit * sizeof(T); }
+
+    friend bool operator==(const SmallVector& a, const SmallVector& b) {
+        return a.size() == b.size() && equal(a.begin(), a.end(), b.begin());
+    }
+
+private:
+    T* items = inlineItems();
+    uint32_t count = 0;
+    uint32_t limit = N;
+    pmr::memory_resource* memory = pmr::get_default_resource();
+    alignas(T) unsigned char storage[N * sizeof(T)];
+
+    T* inlineItems() { return reinterpret_cast<T*>(storage); }
+    const T* inlineItems() const { return reinterpret_cast<const T*>(storage); }
+
+    void assign(const T* first, const T* last) {
+        count = 0;
+        reserve(static_cast<size_t>(last - first));
+        if (first != last) memcpy(static_cast<void*>(items), first, (last - first) * sizeof(T));
+        count = static_cast<uint32_t>(last - first);
+    }
+
+    void grow(size_t wanted) {
+        T* heap = static_cast<T*>(memory->allocate(wanted * sizeof(T), alignof(T)));
+        if (count) memcpy(static_cast<void*>(heap), items, count * sizeof(T));
+        release();
+        items = heap;
+        limit = static_cast<uint32_t>(wanted);
+    }
+
+    void release() {
+        if (!isInline()) memory->deallocate(items, limit * sizeof(T), alignof(T));
+        items = inlineItems();
+        limit = N;
+    }
+
+    // Takes other's elements, leaving it empty; heap storage changes hands
+    void take(SmallVector& other) {
+        count = other.count;
+        if (other.isInline()) {
+            items = inlineItems();
+            limit = N;
+            if (count) memcpy(static_cast<void*>(items), other.items, count * sizeof(T));
+        } else {
+            items = other.items;
+            limit = other.limit;
+            other.items = other.inlineItems();
+            other.limit = N;
+        }
+        other.count = 0;
+    }
+};
+
+#endif // SMALL_VECTOR_H
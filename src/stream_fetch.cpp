@@ -0,0 +1,164 @@
+// src/stream_fetch.cpp
+
+#include "stream_fetch.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+
+namespace {
+
+// Single-producer, single-consumer byte pipe between the curl write callback
+// and the parser. The consumer side is a streambuf, so the existing istream
+// based SAX loader reads from it unchanged and blocks in underflow() until
+// the next chunk arrives.
+class ChunkPipe : public streambuf {
+public:
+    explicit ChunkPipe(size_t maxBufferedBytes)
+        : maxBufferedBytes(maxBufferedBytes), bufferedBytes(0), finished(false), cancelled(false) {}
+
+    // Producer: queues a copy of the chunk, waiting while the pipe is full.
+    // Returns false once the consumer has stopped reading.
+    bool push(const char* data, size_t size) {
+        unique_lock<mutex> lock(pipeMutex);
+        producerWaiting = true;
+        spaceAvailable.wait(lock, [this] { return bufferedBytes < maxBufferedBytes || cancelled; });
+        producerWaiting = false;
+        if (cancelled) return false;
+        chunks.emplace_back(data, size);
+        bufferedBytes += size;
+        if (consumerWaiting) dataAvailable.notify_one();
+        return true;
+    }
+
+    // Producer: no more chunks will follow
+    void finish() {
+        lock_guard<mutex> lock(pipeMutex);
+        finished = true;
+        dataAvailable.notify_one();
+    }
+
+    // Consumer: stops reading and releases a producer waiting for space
+    void cancel() {
+        lock_guard<mutex> lock(pipeMutex);
+        cancelled = true;
+        spaceAvailable.notify_one();
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+        unique_lock<mutex> lock(pipeMutex);
+        consumerWaiting = true;
+        dataAvailable.wait(lock, [this] { return !chunks.empty() || finished; });
+        consumerWaiting = false;
+        if (chunks.empty()) return traits_type::eof();
+        current = std::move(chunks.front());
+        chunks.pop_front();
+        bufferedBytes -= current.size();
+        if (producerWaiting) spaceAvailable.notify_one();
+        lock.unlock();
+
+        char* begin = &current[0];
+        setg(begin, begin, begin + current.size());
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    size_t maxBufferedBytes;
+    size_t bufferedBytes;
+    bool finished;
+    bool cancelled;
+    bool consumerWaiting = false;
+    bool producerWaiting = false;
+    deque<string> chunks;
+    string current; // Chunk the get area points into
+    mutex pipeMutex;
+    condition_variable dataAvailable;
+    condition_variable spaceAvailable;
+};
+
+// Value of one query parameter of a URL, empty if it is absent
+string queryValue(const string& url, const string& name) {
+    size_t query = url.find('?');
+    for (size_t begin = query; begin != string::npos; begin = url.find('&', begin + 1)) {
+        if (url.compare(begin + 1, name.size() + 1, name + "=") == 0) {
+            size_t valueBegin = begin + name.size() + 2;
+            return url.substr(valueBegin, url.find('&', valueBegin) - valueBegin);
+        }
+    }
+    return "";
+}
+
+// Names a request in the log by its date range and the URL without its
+// query string, which carries the API key
+string describeRequest(const string& url) {
+    string baseUrl = url.substr(0, url.find('?'));
+    string startDate = queryValue(url, "start_date");
+    string endDate = queryValue(url, "end_date");
+    if (startDate.empty() || endDate.empty()) {
+        return baseUrl;
+    }
+    return startDate + " to " + endDate + " from " + baseUrl;
+}
+
+double secondsSince(chrono::steady_clock::time_point start) {
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+// Function to download and parse a NeoWs feed at the same time
+bool stream_neo_url(FetchSession& session, const string& url, const AsteroidHandler& onAsteroid,
+                    StreamFetchStats* stats, size_t maxBufferedBytes) {
+    StreamFetchStats local;
+    StreamFetchStats& timing = stats ? *stats : local;
+    timing = StreamFetchStats();
+    auto start = chrono::steady_clock::now();
+
+    ChunkPipe pipe(maxBufferedBytes);
+    bool transferred = false;
+    thread download([&] {
+        transferred = session.stream(url, [&](const char* data, size_t size) {
+            timing.bytes += size;
+            return pipe.push(data, size);
+        });
+        pipe.finish();
+    });
+
+    bool parsed;
+    try {
+        istream input(&pipe);
+        parsed = stream_neo_data(input, [&](const string& date, const Asteroid& asteroid) {
+            if (timing.records++ == 0) {
+                timing.firstRecordSeconds = secondsSince(start);
+            }
+            onAsteroid(date, asteroid);
+        });
+    } catch (...) {
+        pipe.cancel();
+        download.join();
+        throw;
+    }
+    // A parse error leaves the rest of the body unread
+    pipe.cancel();
+    download.join();
+    timing.totalSeconds = secondsSince(start);
+
+    if (!transferred) {
+        return false;
+    }
+    if (session.lastStatus() != 200) {
+        cerr << "NeoWs request failed with HTTP status " << session.lastStatus() << " for " << describeRequest(url)
+             << endl;
+        return false;
+    }
+    if (!parsed) {
+        cerr << "Invalid feed returned for " << describeRequest(url) << endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,30 @@
+// src/stream_fetch.h
+
+#ifndef STREAM_FETCH_H
+#define STREAM_FETCH_H
+
+#include <cstddef>
+#include <string>
+#include "fetch_session.h"
+#include "neo_stream.h"
+
+// Where the time of a streamed fetch went
+struct StreamFetchStats {
+    double firstRecordSeconds = -1; // Request start to the first NEO handed out, -1 if none
+    double totalSeconds = 0;        // Request start to the last byte parsed
+    size_t records = 0;
+    size_t bytes = 0;               // Decoded body bytes received
+};
+
+// Downloads a NeoWs feed and parses it while it is still arriving.
+// The transfer runs on a worker thread whose write callback pushes each
+// chunk into a bounded pipe; the calling thread reads the pipe through the
+// SAX loader (see stream_neo_data), so onAsteroid is called on the calling
+// thread as soon as each NEO's closing brace has been received.
+// If the parser gets ahead of the network it waits for the next chunk;
+// if it falls behind, the transfer pauses once maxBufferedBytes are queued.
+// Returns false on transport errors, a non-200 status or an invalid feed.
+bool stream_neo_url(FetchSession& session, const string& url, const AsteroidHandler& onAsteroid,
+                    StreamFetchStats* stats = nullptr, size_t maxBufferedBytes = 1 << 20);
+
+#endif // STREAM_FETCH_H
@@ -0,0 +1,16 @@
+// src/string_arena.cpp
+
+#include "string_arena.h"
+#include <limits>
+#include <stdexcept>
+
+ArenaRef StringArena::add(string_view text) {
+    if (storage.size() + text.size() > numeric_limits<uint32_t>::max()) {
+        throw length_error("String arena is full");
+    }
+    ArenaRef ref;
+    ref.offset = static_cast<uint32_t>(storage.size());
+    ref.length = static_cast<uint32_t>(text.size());
+    storage.insert(storage.end(), text.begin(), text.end());
+    return ref;
+}
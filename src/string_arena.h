@@ -0,0 +1,43 @@
+// src/string_arena.h
+
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+// Position of a string inside a StringArena
+struct ArenaRef {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+// Append-only storage for many short strings.
+// All characters live back to back in one buffer, so storing a string costs
+// no allocation of its own; the buffer grows geometrically like a vector.
+// The string_views returned by view() are invalidated by the next add.
+class StringArena {
+public:
+    // Stores a copy of text
+    ArenaRef add(string_view text);
+
+    string_view view(ArenaRef ref) const { return string_view(storage.data() + ref.offset, ref.length); }
+
+    void clear() { storage.clear(); }
+    void reserve(size_t bytes) { storage.reserve(bytes); }
+
+    // Characters stored
+    size_t size() const { return storage.size(); }
+
+    // Heap bytes held
+    size_t memoryUsage() const { return storage.capacity(); }
+
+private:
+    vector<char> storage;
+};
+
+#endif // STRING_ARENA_H
@@ -0,0 +1,124 @@
+// tests/test_approach_index.cpp
+
+#include <gtest/gtest.h>
+#include "src/approach_index.h"
+#include "src/body_physics.h"
+#include "src/feed_hydration.h"
+#include "src/get_data.h"
+#include "src/neo_dates.h"
+
+class ApproachIndexTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+        ASSERT_TRUE(extract_feed_fields(feed, fields, 1));
+        index.build(fields.rows);
+    }
+    static json feed;
+    static FeedFields fields;
+    static CloseApproachIndex index;
+
+    // The same query answered by a scan over every approach
+    static std::vector<ApproachHit> scan(int64_t fromMs, int64_t toMs, double maxMissAu) {
+        std::vector<ApproachHit> hits;
+        for (size_t row = 0; row < fields.rows.size(); row++) {
+            const auto& approaches = fields.rows[row].closeApproaches;
+            for (size_t i = 0; i < approaches.size(); i++) {
+                double au = approaches[i].miss_distance / BodyPhysics::kmPerAu;
+                if (approaches[i].epochMs >= fromMs && approaches[i].epochMs < toMs && au < maxMissAu) {
+                    hits.push_back({uint32_t(row), uint32_t(i), approaches[i].epochMs, au});
+                }
+            }
+        }
+        std::sort(hits.begin(), hits.end(), [](const ApproachHit& a, const ApproachHit& b) {
+            return std::tie(a.epochMs, a.row, a.approach) < std::tie(b.epochMs, b.row, b.approach);
+        });
+        return hits;
+    }
+};
+
+json ApproachIndexTest::feed;
+FeedFields ApproachIndexTest::fields;
+CloseApproachIndex ApproachIndexTest::index;
+
+TEST_F(ApproachIndexTest, FullDatesMatchFeedEpochs) {
+    size_t checked = 0;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            for (const auto& approach : neo["close_approach_data"]) {
+                int64_t epochMs = 0;
+                ASSERT_TRUE(NeoDates::parseFullDate(approach["close_approach_date_full"].get<std::string>(), epochMs));
+                EXPECT_EQ(epochMs, approach["epoch_date_close_approach"].get<int64_t>());
+                checked++;
+            }
+        }
+    }
+    EXPECT_EQ(checked, index.size());
+
+    int64_t epochMs = 0;
+    EXPECT_TRUE(NeoDates::parseFullDate("1969-Dec-31 23:59", epochMs));
+    EXPECT_EQ(epochMs, -60000);
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Sept-30 02:06", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-sep-30 02:06", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Sep-30 24:00", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Sep-30 02:60", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Sep-30", epochMs));
+    EXPECT_TRUE(NeoDates::parseFullDate("2024-Feb-29 12:00", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2023-Feb-29 12:00", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Feb-30 12:00", epochMs));
+    EXPECT_FALSE(NeoDates::parseFullDate("2024-Apr-31 12:00", epochMs));
+}
+
+TEST_F(ApproachIndexTest, QueriesMatchScan) {
+    int64_t day = NeoDates::msPerDay;
+    int64_t first = NeoDates::daysFromCivil(2024, 9, 27) * day;
+    const double distances[] = {0.0, 0.01, 0.05, 0.2, 10.0};
+    for (int64_t from = first - day; from < first + 9 * day; from += day / 3) {
+        for (int64_t length : {day / 4, day, 3 * day, 10 * day}) {
+            for (double maxAu : distances) {
+                std::vector<ApproachHit> hits;
+                index.query(from, from + length, maxAu, hits);
+                auto expected = scan(from, from + length, maxAu);
+                ASSERT_EQ(hits.size(), expected.size()) << from << " " << length << " " << maxAu;
+                for (size_t i = 0; i < hits.size(); i++) {
+                    EXPECT_EQ(hits[i].row, expected[i].row);
+                    EXPECT_EQ(hits[i].approach, expected[i].approach);
+                    EXPECT_EQ(hits[i].epochMs, expected[i].epochMs);
+                    EXPECT_EQ(hits[i].missDistanceAu, expected[i].missDistanceAu);
+                }
+            }
+        }
+    }
+    EXPECT_EQ(index.countInRange(first - day, first + 9 * day), index.size());
+}
+
+// The week of data.json under 0.05 au, read back through the rows
+TEST_F(ApproachIndexTest, CloseApproachesInWeek) {
+    int64_t from = NeoDates::daysFromCivil(2024, 9, 27) * NeoDates::msPerDay;
+    int64_t to = NeoDates::daysFromCivil(2024, 10, 5) * NeoDates::msPerDay;
+    std::vector<ApproachHit> hits;
+    index.query(from, to, 0.05, hits);
+    ASSERT_FALSE(hits.empty());
+    EXPECT_LT(hits.size(), index.size());
+    for (size_t i = 0; i < hits.size(); i++) {
+        const CloseApproachData& approach = fields.rows[hits[i].row].closeApproaches[hits[i].approach];
+        EXPECT_EQ(approach.epochMs, hits[i].epochMs);
+        EXPECT_LT(approach.miss_distance, 0.05 * BodyPhysics::kmPerAu);
+        if (i > 0) {
+            EXPECT_LE(hits[i - 1].epochMs, hits[i].epochMs);
+        }
+    }
+
+    std::vector<ApproachHit> none;
+    index.query(to, from, 1.0, none);
+    CloseApproachIndex empty;
+    empty.build({});
+    empty.query(from, to, 1.0, none);
+    EXPECT_TRUE(none.empty());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
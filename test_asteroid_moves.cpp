@@ -0,0 +1,158 @@
+// tests/test_asteroid_moves.cpp
+
+#include <gtest/gtest.h>
+#include "src/classes.h"
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+// Heap allocations made while `counting` is set
+static size_t allocations = 0;
+static bool counting = false;
+
+// The replacements are kept out of line: once inlined into gtest's
+// new-expressions, GCC pairs malloc() and free() with them and reports
+// matching calls as mismatched
+__attribute__((noinline)) void* operator new(size_t size) {
+    if (counting) allocations++;
+    void* block = malloc(size ? size : 1);
+    if (!block) throw std::bad_alloc();
+    return block;
+}
+
+__attribute__((noinline)) void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+__attribute__((noinline)) void operator delete(void* block) noexcept {
+    free(block);
+}
+
+__attribute__((noinline)) void operator delete(void* block, size_t) noexcept {
+    free(block);
+}
+
+__attribute__((noinline)) void operator delete[](void* block) noexcept {
+    free(block);
+}
+
+__attribute__((noinline)) void operator delete[](void* block, size_t) noexcept {
+    free(block);
+}
+
+// Counts the allocations made by body()
+template <typename Body>
+static size_t allocationsDuring(Body body) {
+    allocations = 0;
+    counting = true;
+    body();
+    counting = false;
+    return allocations;
+}
+
+static_assert(std::is_nothrow_move_constructible<Asteroid>::value, "vector<Asteroid> must move, not copy, on growth");
+static_assert(std::is_move_assignable<Asteroid>::value, "Asteroid must be move assignable"); // Copies across memory resources
+static_assert(std::is_nothrow_move_constructible<Planet>::value, "Planet must be movable");
+
+class AsteroidMovesTest : public ::testing::Test {
+protected:
+    // Names long enough to live on the heap rather than in the string itself
+    static Asteroid makeAsteroid(int index) {
+        NeoFields fields;
+        fields.id = "20000000" + std::to_string(index);
+        fields.name = "Asteroid number " + std::to_string(index) + " (2024 AB)";
+        fields.nasaJplUrl = "https://ssd.jpl.nasa.gov/tools/sbdb_lookup.html#/?sstr=" + fields.id;
+        fields.minDiameterKm = 0.1 + index * 0.001;
+        fields.maxDiameterKm = 0.2 + index * 0.001;
+        fields.closeApproaches.push_back({"2024-09-30", 10.0 + index, 2.0e6});
+        fields.closeApproaches.push_back({"2031-03-02", 11.0, 3.0e6});
+        return Asteroid(std::move(fields));
+    }
+};
+
+// Reallocating a vector<Asteroid> moves the elements: one allocation in total
+TEST_F(AsteroidMovesTest, VectorGrowthMovesElements) {
+    std::vector<Asteroid> asteroids;
+    asteroids.reserve(1);
+    for (int i = 0; i < 1000; i++) {
+        Asteroid asteroid = makeAsteroid(i);
+        if (asteroids.size() == asteroids.capacity()) {
+            EXPECT_EQ(allocationsDuring([&] { asteroids.push_back(std::move(asteroid)); }), 1u) << i;
+        } else {
+            EXPECT_EQ(allocationsDuring([&] { asteroids.push_back(std::move(asteroid)); }), 0u) << i;
+        }
+    }
+    EXPECT_EQ(asteroids[999].getName(), "Asteroid number 999 (2024 AB)");
+    EXPECT_EQ(asteroids[999].getCloseApproachCount(), 2u);
+
+    EXPECT_EQ(allocationsDuring([&] { asteroids.reserve(asteroids.capacity() * 2); }), 1u);
+    EXPECT_EQ(allocationsDuring([&] { asteroids.erase(asteroids.begin()); }), 0u);
+    EXPECT_EQ(asteroids.front().getName(), "Asteroid number 1 (2024 AB)");
+}
+
+TEST_F(AsteroidMovesTest, GettersDoNotCopy) {
+    std::vector<Asteroid> asteroids;
+    for (int i = 0; i < 100; i++) asteroids.push_back(makeAsteroid(i));
+
+    size_t characters = 0;
+    size_t made = allocationsDuring([&] {
+        for (const auto& asteroid : asteroids) {
+            characters += asteroid.getID().size() + asteroid.getName().size() + asteroid.getNasaJplUrl().size();
+            for (const auto& approach : asteroid.getCloseApproachData()) characters += approach.date.days() > 0;
+        }
+    });
+    EXPECT_EQ(made, 0u);
+    EXPECT_GT(characters, 0u);
+}
+
+// Combining in place only grows the accumulated name, geometrically
+TEST_F(AsteroidMovesTest, CombineInPlaceDoesNotAllocatePerElement) {
+    std::vector<Asteroid> asteroids;
+    for (int i = 0; i < 1000; i++) asteroids.push_back(makeAsteroid(i));
+
+    Asteroid total = asteroids[0];
+    size_t made = allocationsDuring([&] {
+        for (size_t i = 1; i < asteroids.size(); i++) total += asteroids[i];
+    });
+    EXPECT_LT(made, 40u);
+
+    double mass = 0;
+    for (const auto& asteroid : asteroids) mass += asteroid.getMass();
+    EXPECT_DOUBLE_EQ(total.getMass(), mass);
+    EXPECT_EQ(total.getName().substr(0, 55), "Asteroid number 0 (2024 AB) & Asteroid number 1 (2024 A");
+}
+
+// a + b + c copies a once and then reuses the temporary
+TEST_F(AsteroidMovesTest, ChainedPlusReusesTemporary) {
+    Asteroid a = makeAsteroid(1), b = makeAsteroid(2), c = makeAsteroid(3);
+    Asteroid expected = a;
+    expected += b;
+    expected += c;
+
+    size_t copyOfA = allocationsDuring([&] { Asteroid copy(a); });
+    size_t chained = allocationsDuring([&] {
+        Asteroid combined = a + b + c;
+        EXPECT_EQ(combined.getName(), expected.getName());
+        EXPECT_DOUBLE_EQ(combined.getMass(), expected.getMass());
+        EXPECT_DOUBLE_EQ(combined.getRelativeVelocityKmPerS(), expected.getRelativeVelocityKmPerS());
+        EXPECT_EQ(combined.isDangerous(), expected.isDangerous());
+    });
+    // The copy of a, plus at most one regrowth of the name per +
+    EXPECT_LE(chained, copyOfA + 2);
+}
+
+TEST_F(AsteroidMovesTest, MovedValuesArePreserved) {
+    Asteroid source = makeAsteroid(7);
+    Asteroid target = makeAsteroid(8);
+    size_t made = allocationsDuring([&] { target = std::move(source); });
+    EXPECT_EQ(made, 0u);
+    EXPECT_EQ(target.getID(), "200000007");
+    EXPECT_EQ(target.getCloseApproachData()[0].date, "2024-09-30");
+    EXPECT_DOUBLE_EQ(target.getMissDistanceKm(), makeAsteroid(7).getMissDistanceKm());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,188 @@
+// tests/test_asteroid_table.cpp
+
+#include <gtest/gtest.h>
+#include "src/asteroid_table.h"
+#include "src/get_data.h"
+#include <memory>
+
+class AsteroidTableTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+        for (const auto& date : feed["near_earth_objects"].items()) {
+            for (const auto& neo : date.value()) asteroids.emplace_back(new Asteroid(neo));
+        }
+    }
+    static void TearDownTestSuite() {
+        asteroids.clear();
+    }
+    static json feed;
+    static std::vector<std::unique_ptr<Asteroid>> asteroids;
+};
+
+json AsteroidTableTest::feed;
+std::vector<std::unique_ptr<Asteroid>> AsteroidTableTest::asteroids;
+
+static void expectSameAsteroid(const AsteroidRow& row, const Asteroid& asteroid) {
+    EXPECT_EQ(row.getID(), asteroid.getID());
+    EXPECT_EQ(row.getName(), asteroid.getName());
+    EXPECT_EQ(row.getNasaJplUrl(), asteroid.getNasaJplUrl());
+    EXPECT_EQ(row.getMass(), asteroid.getMass());
+    EXPECT_EQ(row.getDiameter(), asteroid.getDiameter());
+    EXPECT_EQ(row.getMaxDiameterKm(), asteroid.getMaxDiameterKm());
+    EXPECT_EQ(row.getAbsoluteMagnitude(), asteroid.getAbsoluteMagnitude());
+    EXPECT_EQ(row.getRelativeVelocityKmPerS(), asteroid.getRelativeVelocityKmPerS());
+    EXPECT_EQ(row.getMissDistanceKm(), asteroid.getMissDistanceKm());
+    EXPECT_EQ(row.isDangerous(), asteroid.isDangerous());
+    EXPECT_EQ(row.calculateSurfaceGravity(), asteroid.calculateSurfaceGravity());
+    EXPECT_EQ(row.calculateEscapeVelocity(), asteroid.calculateEscapeVelocity());
+    EXPECT_EQ(row.calculateImpactEnergy(), asteroid.calculateImpactEnergy());
+
+    auto expected = asteroid.getCloseApproachData();
+    auto actual = row.getCloseApproachData();
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(row.getCloseApproachCount(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        EXPECT_EQ(actual[i].date, expected[i].date);
+        EXPECT_EQ(actual[i].epochMs, expected[i].epochMs);
+        EXPECT_EQ(actual[i].relative_velocity, expected[i].relative_velocity);
+        EXPECT_EQ(actual[i].miss_distance, expected[i].miss_distance);
+        EXPECT_EQ(actual[i].reported_miss_distance, expected[i].reported_miss_distance);
+    }
+}
+
+// Rows loaded from a feed read back exactly like Asteroids built from it
+TEST_F(AsteroidTableTest, FeedRowsMatchAsteroids) {
+    AsteroidTable table;
+    ASSERT_TRUE(table.loadFeed(feed, 2));
+    ASSERT_EQ(table.size(), asteroids.size());
+    EXPECT_EQ(table.approachBegin().size(), table.size() + 1);
+    for (size_t i = 0; i < table.size(); i++) {
+        expectSameAsteroid(table[i], *asteroids[i]);
+    }
+}
+
+// Appending an Asteroid keeps its own mass and adjusted miss distances
+TEST_F(AsteroidTableTest, AppendedAsteroidsMatch) {
+    AsteroidTable table;
+    for (const auto& asteroid : asteroids) table.append(*asteroid);
+    ASSERT_EQ(table.size(), asteroids.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        expectSameAsteroid(table[i], *asteroids[i]);
+    }
+}
+
+TEST_F(AsteroidTableTest, BulkComputationsMatchPerObject) {
+    AsteroidTable table;
+    ASSERT_TRUE(table.loadFeed(feed));
+
+    std::vector<double> gravity, escape, energy;
+    table.surfaceGravities(gravity);
+    table.escapeVelocities(escape);
+    table.impactEnergies(energy);
+    ASSERT_EQ(energy.size(), asteroids.size());
+
+    size_t hazardous = 0;
+    double totalMass = 0;
+    for (size_t i = 0; i < asteroids.size(); i++) {
+        EXPECT_EQ(gravity[i], asteroids[i]->calculateSurfaceGravity());
+        EXPECT_EQ(escape[i], asteroids[i]->calculateEscapeVelocity());
+        EXPECT_EQ(energy[i], asteroids[i]->calculateImpactEnergy());
+        hazardous += asteroids[i]->isDangerous();
+        totalMass += asteroids[i]->getMass();
+    }
+    EXPECT_EQ(table.countHazardous(), hazardous);
+    EXPECT_GT(hazardous, 0u);
+    EXPECT_EQ(table.totalMass(), totalMass);
+}
+
+// Hazard flags land in the right bit across word boundaries
+TEST_F(AsteroidTableTest, HazardBitmapSpansWords) {
+    AsteroidTable table;
+    NeoFields fields;
+    fields.id = "1";
+    fields.name = "Row";
+    fields.minDiameterKm = 0.1;
+    fields.maxDiameterKm = 0.2;
+    for (int i = 0; i < 130; i++) {
+        fields.potentiallyHazardous = (i % 3 == 0) || i == 64;
+        table.append(fields);
+    }
+    ASSERT_EQ(table.hazardBitmap().size(), 3u);
+    size_t expected = 0;
+    for (int i = 0; i < 130; i++) {
+        bool hazardous = (i % 3 == 0) || i == 64;
+        EXPECT_EQ(table.isHazardous(i), hazardous) << i;
+        expected += hazardous;
+    }
+    EXPECT_EQ(table.countHazardous(), expected);
+    EXPECT_EQ(table[129].getRelativeVelocityKmPerS(), 0.0);
+    EXPECT_EQ(table[129].getCloseApproachCount(), 0u);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.approachBegin().size(), 1u);
+}
+
+// Ids are kept as numbers and URLs rebuilt from them, unless they do not fit that pattern
+TEST_F(AsteroidTableTest, SynthesizesIdsAndUrls) {
+    AsteroidTable table;
+    NeoFields fields;
+    fields.minDiameterKm = 0.1;
+    fields.maxDiameterKm = 0.2;
+
+    fields.id = "2154229";
+    fields.name = "154229 (2002 JN97)";
+    fields.nasaJplUrl = AsteroidTable::jplUrlPrefix + "2154229";
+    table.append(fields);
+
+    fields.id = "00123"; // Would not print back the same as a number
+    fields.name = "Padded";
+    fields.nasaJplUrl = AsteroidTable::jplUrlPrefix + "00123";
+    table.append(fields);
+
+    fields.id = "54321";
+    fields.name = "Elsewhere";
+    fields.nasaJplUrl = "https://example.org/neo/54321";
+    table.append(fields);
+
+    uint64_t id = 0;
+    EXPECT_TRUE(table.numericId(0, id));
+    EXPECT_EQ(id, 2154229u);
+    EXPECT_EQ(table[0].getID(), "2154229");
+    EXPECT_EQ(table[0].getName(), "154229 (2002 JN97)");
+    EXPECT_EQ(table[0].getNasaJplUrl(), AsteroidTable::jplUrlPrefix + "2154229");
+
+    EXPECT_FALSE(table.numericId(1, id));
+    EXPECT_EQ(table[1].getID(), "00123");
+    EXPECT_EQ(table[1].getNasaJplUrl(), AsteroidTable::jplUrlPrefix + "00123");
+
+    EXPECT_TRUE(table.numericId(2, id));
+    EXPECT_EQ(table[2].getNasaJplUrl(), "https://example.org/neo/54321");
+    EXPECT_EQ(table.name(2), "Elsewhere");
+}
+
+// Strings take a few bytes of arena space per row rather than std::string objects
+TEST_F(AsteroidTableTest, StringsStayCompact) {
+    AsteroidTable table;
+    ASSERT_TRUE(table.loadFeed(feed));
+    size_t nameBytes = 0;
+    for (const auto& asteroid : asteroids) nameBytes += asteroid->getName().size();
+    size_t approaches = table.approachBegin().back();
+    size_t numericBytes = table.size() * (8 * 5) + approaches * (8 * 3 + 4) + (table.size() + 1) * 4;
+    size_t stringBytes = table.memoryUsage() - numericBytes;
+    // Names and one 8-byte ref per name
+    EXPECT_LT(stringBytes, nameBytes + table.size() * 8 + 4096);
+}
+
+TEST_F(AsteroidTableTest, RejectsFeedWithoutNeoMap) {
+    AsteroidTable table;
+    EXPECT_FALSE(table.loadFeed(json::object()));
+    EXPECT_TRUE(table.empty());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
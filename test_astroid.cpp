@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 #include "src/classes.h"      // Includes SpaceBody and Asteroid classes
+#include "src/body_physics.h"
 #include "json.hpp"
 #include <fstream>
 #include <stdexcept>
@@ -226,6 +227,34 @@ TEST_F(AsteroidTest, OperatorPlus) {
     EXPECT_TRUE(combined.isDangerous());
 }
 
+// Cached quantities match the formulas and follow the mass and velocity through +=
+TEST_F(AsteroidTest, DerivedQuantitiesFollowCombination) {
+    NeoFields fields;
+    fields.id = "33333";
+    fields.name = "Cached";
+    fields.minDiameterKm = 0.4;
+    fields.maxDiameterKm = 0.9;
+    fields.closeApproaches.push_back({"2024-10-10", 15.0, 2.0e6});
+    Asteroid asteroid(fields);
+    Asteroid other(fields);
+
+    auto expectCurrent = [](const Asteroid& a) {
+        EXPECT_EQ(a.calculateSurfaceGravity(), BodyPhysics::surfaceGravity(a.getDiameter(), a.getMass()));
+        EXPECT_EQ(a.calculateEscapeVelocity(), BodyPhysics::escapeVelocity(a.getDiameter(), a.getMass()));
+        EXPECT_EQ(a.calculateImpactEnergy(), BodyPhysics::impactEnergy(a.getMass(), a.getRelativeVelocityKmPerS()));
+    };
+    expectCurrent(asteroid);
+    double energyBefore = asteroid.calculateImpactEnergy();
+
+    asteroid += other;
+    expectCurrent(asteroid);
+    EXPECT_DOUBLE_EQ(asteroid.calculateImpactEnergy(), 8 * energyBefore); // Twice the mass, twice the velocity
+
+    Asteroid copy(asteroid);
+    expectCurrent(copy);
+    EXPECT_EQ(copy.calculateImpactEnergy(), asteroid.calculateImpactEnergy());
+}
+
 // Test calculateSurfaceGravity inherited from SpaceBody
 TEST_F(AsteroidTest, CalculateSurfaceGravity) {
     // Create JSON data
@@ -358,7 +387,7 @@ TEST_F(AsteroidTest, ConstructorMultipleCloseApproachData) {
     EXPECT_DOUBLE_EQ(asteroid.getAbsoluteMagnitude(), 17.5);
 
     // Verify close approach data
-    std::vector<CloseApproachData> approaches = asteroid.getCloseApproachData();
+    const CloseApproachList& approaches = asteroid.getCloseApproachData();
     ASSERT_EQ(approaches.size(), 2);
 
     // First approach
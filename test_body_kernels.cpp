@@ -0,0 +1,129 @@
+// tests/test_body_kernels.cpp
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include "src/body_kernels.h"
+#include "src/body_physics.h"
+#include "src/feed_hydration.h"
+#include "src/get_data.h"
+
+using BodyKernels::Level;
+
+// Distance between two doubles of the same sign in units in the last place
+static uint64_t ulpDistance(double a, double b) {
+    int64_t x, y;
+    std::memcpy(&x, &a, sizeof(a));
+    std::memcpy(&y, &b, sizeof(b));
+    return x > y ? uint64_t(x) - uint64_t(y) : uint64_t(y) - uint64_t(x);
+}
+
+class BodyKernelsTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        BodyKernels::setLevel(BodyKernels::supportedLevel());
+    }
+
+    // Every level this CPU runs, scalar first
+    static std::vector<Level> levels() {
+        std::vector<Level> result;
+        for (Level level : {Level::Scalar, Level::Avx2, Level::Avx512}) {
+            if (level <= BodyKernels::supportedLevel()) result.push_back(level);
+        }
+        return result;
+    }
+
+    // Diameters from metres to hundreds of km, velocities of a few to tens of km/s
+    static void makeColumns(size_t count, std::vector<double>& minDiameter, std::vector<double>& maxDiameter,
+                            std::vector<double>& velocity) {
+        std::mt19937_64 random(count);
+        std::uniform_real_distribution<double> exponent(-3.0, 2.5);
+        std::uniform_real_distribution<double> spread(1.0, 2.5);
+        std::uniform_real_distribution<double> speed(1.0, 70.0);
+        minDiameter.resize(count);
+        maxDiameter.resize(count);
+        velocity.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            minDiameter[i] = std::pow(10.0, exponent(random));
+            maxDiameter[i] = minDiameter[i] * spread(random);
+            velocity[i] = speed(random);
+        }
+    }
+};
+
+// Each level against the BodyPhysics functions, at lengths covering every tail
+TEST_F(BodyKernelsTest, MatchScalarReferenceWithinUlpBounds) {
+    for (Level level : levels()) {
+        ASSERT_TRUE(BodyKernels::setLevel(level));
+        EXPECT_EQ(BodyKernels::activeLevel(), level);
+        for (size_t count : {0u, 1u, 3u, 4u, 5u, 7u, 8u, 9u, 15u, 16u, 17u, 1000u, 1003u}) {
+            std::vector<double> minDiameter, maxDiameter, velocity;
+            makeColumns(count, minDiameter, maxDiameter, velocity);
+            std::vector<double> mass(count), gravity(count), escape(count), energy(count);
+            BodyKernels::asteroidMasses(minDiameter.data(), maxDiameter.data(), mass.data(), count);
+            BodyKernels::surfaceGravities(minDiameter.data(), mass.data(), gravity.data(), count);
+            BodyKernels::escapeVelocities(minDiameter.data(), mass.data(), escape.data(), count);
+            BodyKernels::impactEnergies(mass.data(), velocity.data(), energy.data(), count);
+
+            for (size_t i = 0; i < count; i++) {
+                double referenceMass = BodyPhysics::asteroidMass(minDiameter[i], maxDiameter[i]);
+                EXPECT_LE(ulpDistance(mass[i], referenceMass), 4u) << BodyKernels::levelName(level) << " " << i;
+                // The rest from the kernel's own masses, so only the formula under test differs
+                EXPECT_EQ(gravity[i], BodyPhysics::surfaceGravity(minDiameter[i], mass[i]));
+                EXPECT_EQ(escape[i], BodyPhysics::escapeVelocity(minDiameter[i], mass[i]));
+                EXPECT_EQ(energy[i], BodyPhysics::impactEnergy(mass[i], velocity[i]));
+            }
+        }
+    }
+}
+
+// The columns of data.json give what the Asteroid objects cached
+TEST_F(BodyKernelsTest, MatchAsteroidsOfFeed) {
+    json feed;
+    ASSERT_TRUE(load_from_file(feed, "data.json"));
+    AsteroidFeed asteroids;
+    ASSERT_TRUE(hydrate_feed(feed, asteroids, 1));
+    size_t count = asteroids.asteroids.size();
+    std::vector<double> minDiameter, maxDiameter, mass, velocity;
+    for (const Asteroid& asteroid : asteroids.asteroids) {
+        minDiameter.push_back(asteroid.getMinDiameterKm());
+        maxDiameter.push_back(asteroid.getMaxDiameterKm());
+        mass.push_back(asteroid.getMass());
+        velocity.push_back(asteroid.getRelativeVelocityKmPerS());
+    }
+
+    for (Level level : levels()) {
+        ASSERT_TRUE(BodyKernels::setLevel(level));
+        std::vector<double> masses(count), gravity(count), energy(count);
+        BodyKernels::asteroidMasses(minDiameter.data(), maxDiameter.data(), masses.data(), count);
+        BodyKernels::surfaceGravities(minDiameter.data(), mass.data(), gravity.data(), count);
+        BodyKernels::impactEnergies(mass.data(), velocity.data(), energy.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            const Asteroid& asteroid = asteroids.asteroids[i];
+            EXPECT_LE(ulpDistance(masses[i], asteroid.getMass()), 4u);
+            EXPECT_EQ(gravity[i], asteroid.calculateSurfaceGravity());
+            EXPECT_EQ(energy[i], asteroid.calculateImpactEnergy());
+        }
+    }
+}
+
+// Results may overwrite an input column
+TEST_F(BodyKernelsTest, OutputMayAliasInput) {
+    std::vector<double> minDiameter, maxDiameter, velocity;
+    makeColumns(21, minDiameter, maxDiameter, velocity);
+    for (Level level : levels()) {
+        ASSERT_TRUE(BodyKernels::setLevel(level));
+        std::vector<double> expected(21), inPlace = maxDiameter;
+        BodyKernels::asteroidMasses(minDiameter.data(), maxDiameter.data(), expected.data(), 21);
+        BodyKernels::asteroidMasses(minDiameter.data(), inPlace.data(), inPlace.data(), 21);
+        EXPECT_EQ(inPlace, expected);
+    }
+    EXPECT_TRUE(BodyKernels::setLevel(Level::Scalar));
+    EXPECT_STREQ(BodyKernels::levelName(Level::Avx512), "AVX-512");
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+// tests/test_body_set.cpp
+
+#include <gtest/gtest.h>
+#include "src/body_set.h"
+#include "src/get_data.h"
+#include "src/planets.h"
+
+class BodySetTest : public ::testing::Test {
+protected:
+    static NeoFields asteroidFields(const std::string& name, double minKm, double maxKm, double velocity) {
+        NeoFields fields;
+        fields.id = "1";
+        fields.name = name;
+        fields.minDiameterKm = minKm;
+        fields.maxDiameterKm = maxKm;
+        fields.closeApproaches.push_back({"2024-10-10", velocity, 1.0e6});
+        return fields;
+    }
+};
+
+TEST_F(BodySetTest, BatchResultsMatchObjects) {
+    BodySet set;
+    set.addSolarSystem();
+    set.add(Asteroid(asteroidFields("Small", 0.1, 0.2, 10.0)));
+    set.add(Planet("Ceres", 939.4, 9.3835e20));
+    set.add(Asteroid(asteroidFields("Large", 1.5, 3.0, 20.0)));
+    ASSERT_EQ(set.size(), SolarSystem::predefinedPlanets.size() + 3);
+
+    std::vector<double> gravity, escape;
+    set.surfaceGravities(gravity);
+    set.escapeVelocities(escape);
+    double mass = 0;
+    for (size_t i = 0; i < set.size(); i++) {
+        const SpaceBody& body = BodySet::base(set[i]);
+        EXPECT_EQ(gravity[i], body.calculateSurfaceGravity()) << body.getName();
+        EXPECT_EQ(escape[i], body.calculateEscapeVelocity()) << body.getName();
+        mass += body.getMass();
+    }
+    EXPECT_EQ(set.totalMass(), mass);
+    EXPECT_EQ(set.countAsteroids(), 2u);
+
+    const Planet* earth = std::get_if<Planet>(&set[2]);
+    ASSERT_NE(earth, nullptr);
+    EXPECT_EQ(earth->getName(), "Earth");
+    EXPECT_NEAR(gravity[2], 9.82, 0.01);
+}
+
+// forEach hands every body over as its own type, in insertion order
+TEST_F(BodySetTest, ForEachVisitsConcreteTypes) {
+    BodySet set;
+    set.add(Planet("Mars", 6779, 6.4171e23));
+    set.add(Asteroid(asteroidFields("Rock", 0.5, 1.0, 12.0)));
+    set.add(Planet("Venus", 12104, 4.8675e24));
+
+    std::string order;
+    double impactEnergy = 0;
+    set.forEach([&](const auto& body) {
+        using Type = std::decay_t<decltype(body)>;
+        if constexpr (std::is_same<Type, Asteroid>::value) {
+            order += "A:";
+            impactEnergy += body.calculateImpactEnergy();
+        } else {
+            order += "P:";
+        }
+        order.append(body.getName()) += " ";
+    });
+    EXPECT_EQ(order, "P:Mars A:Rock P:Venus ");
+    EXPECT_GT(impactEnergy, 0.0);
+}
+
+TEST_F(BodySetTest, HoldsFeedAsteroidsByValue) {
+    json feed;
+    ASSERT_TRUE(load_from_file(feed, "data.json"));
+    BodySet set;
+    set.addSolarSystem();
+    size_t asteroids = 0;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            set.add(Asteroid(neo));
+            asteroids++;
+        }
+    }
+    EXPECT_EQ(set.countAsteroids(), asteroids);
+
+    std::vector<double> escape;
+    set.escapeVelocities(escape);
+    const Asteroid& last = std::get<Asteroid>(set.all().back());
+    EXPECT_EQ(escape.back(), last.calculateEscapeVelocity());
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+// tests/test_feed_hydration.cpp
+
+#include <gtest/gtest.h>
+#include <map>
+#include "src/feed_hydration.h"
+#include "src/get_data.h"
+
+// Upstream for an AsteroidFeed arena that remembers the blocks it handed out
+class BlockTracker : public std::pmr::memory_resource {
+public:
+    std::map<const char*, size_t> blocks; // Start and size of each live block
+    size_t allocations = 0;
+
+    bool owns(const void* pointer) const {
+        const char* byte = static_cast<const char*>(pointer);
+        auto block = blocks.upper_bound(byte);
+        return block != blocks.begin() && byte < (--block)->first + block->second;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* block = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        blocks[static_cast<const char*>(block)] = bytes;
+        allocations++;
+        return block;
+    }
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override {
+        blocks.erase(static_cast<const char*>(block));
+        std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+class FeedHydrationTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+    }
+    static json feed;
+};
+
+json FeedHydrationTest::feed;
+
+// Every thread count yields the rows the per-object constructor yields, in feed order
+TEST_F(FeedHydrationTest, MatchesPerObjectConstruction) {
+    for (unsigned threads : {1u, 2u, 5u, 0u}) {
+        AsteroidFeed table;
+        ASSERT_TRUE(hydrate_feed(feed, table, threads));
+        ASSERT_EQ(table.asteroids.size(), feed["element_count"].get<size_t>());
+        ASSERT_EQ(table.dateBegin.size(), table.dates.size() + 1);
+
+        size_t date = 0;
+        for (const auto& entry : feed["near_earth_objects"].items()) {
+            ASSERT_EQ(table.dates[date], entry.key());
+            size_t row = table.dateBegin[date];
+            ASSERT_EQ(table.dateBegin[date + 1] - row, entry.value().size());
+            for (const auto& neo : entry.value()) {
+                Asteroid expected(neo);
+                const Asteroid& actual = table.asteroids[row++];
+                EXPECT_EQ(actual.getID(), expected.getID());
+                EXPECT_EQ(actual.getMass(), expected.getMass());
+                EXPECT_EQ(actual.getMissDistanceKm(), expected.getMissDistanceKm());
+                EXPECT_EQ(actual.getCloseApproachData().size(), expected.getCloseApproachData().size());
+            }
+            date++;
+        }
+        EXPECT_EQ(date, table.dates.size());
+    }
+}
+
+// A malformed record is dropped and the date offsets close up around it
+TEST_F(FeedHydrationTest, SkipsMalformedRecords) {
+    json broken = feed;
+    auto& neoMap = broken["near_earth_objects"];
+    std::string firstDate = neoMap.begin().key();
+    size_t firstCount = neoMap[firstDate].size();
+    ASSERT_GE(firstCount, 2u);
+    neoMap[firstDate][1].erase("estimated_diameter");
+
+    FeedFields fields;
+    ASSERT_TRUE(extract_feed_fields(broken, fields, 3));
+    EXPECT_EQ(fields.rows.size(), feed["element_count"].get<size_t>() - 1);
+    EXPECT_EQ(fields.dateBegin[1], firstCount - 1);
+    EXPECT_EQ(fields.dateBegin.back(), fields.rows.size());
+    EXPECT_EQ(fields.rows[0].id, neoMap[firstDate][0]["id"].get<std::string>());
+    EXPECT_EQ(fields.rows[1].id, neoMap[firstDate][2]["id"].get<std::string>());
+}
+
+// The asteroids, their strings and extra close approaches all sit in a few
+// arena blocks, and clearing the feed hands every block back
+TEST_F(FeedHydrationTest, AsteroidsLiveInFeedArena) {
+    BlockTracker upstream;
+    AsteroidFeed table(&upstream);
+    ASSERT_TRUE(hydrate_feed(feed, table, 2));
+    ASSERT_FALSE(table.asteroids.empty());
+    EXPECT_LT(upstream.allocations, 16u);
+
+    for (const Asteroid& asteroid : table.asteroids) {
+        EXPECT_TRUE(upstream.owns(&asteroid));
+        EXPECT_TRUE(upstream.owns(asteroid.getName().data()));
+        EXPECT_TRUE(upstream.owns(asteroid.getID().data()));
+        EXPECT_TRUE(upstream.owns(asteroid.getNasaJplUrl().data()));
+        EXPECT_TRUE(upstream.owns(asteroid.getCloseApproachData().data()));
+    }
+    size_t blocksUsed = upstream.allocations;
+    table.clear();
+    EXPECT_TRUE(upstream.blocks.empty());
+    EXPECT_TRUE(table.asteroids.empty());
+
+    // Refilling starts from an empty arena
+    ASSERT_TRUE(hydrate_feed(feed, table, 2));
+    EXPECT_EQ(upstream.allocations, 2 * blocksUsed);
+}
+
+// Copies go to the default resource and outlive the feed
+TEST_F(FeedHydrationTest, CopiesOutliveFeed) {
+    std::vector<Asteroid> kept;
+    std::vector<std::string> names;
+    {
+        BlockTracker upstream;
+        AsteroidFeed table(&upstream);
+        ASSERT_TRUE(hydrate_feed(feed, table, 1));
+        for (size_t i = 0; i < table.asteroids.size(); i += 7) {
+            kept.push_back(table.asteroids[i]);
+            names.emplace_back(table.asteroids[i].getName());
+            EXPECT_FALSE(upstream.owns(kept.back().getNasaJplUrl().data()));
+        }
+    }
+    ASSERT_FALSE(kept.empty());
+    for (size_t i = 0; i < kept.size(); i++) {
+        EXPECT_EQ(kept[i].getName(), names[i]);
+        EXPECT_EQ(kept[i].getNasaJplUrl().substr(0, 8), "https://");
+    }
+}
+
+TEST_F(FeedHydrationTest, RejectsFeedWithoutNeoMap) {
+    AsteroidFeed table;
+    EXPECT_FALSE(hydrate_feed(json::object(), table));
+    EXPECT_FALSE(hydrate_feed(json::array(), table));
+    EXPECT_TRUE(table.asteroids.empty());
+
+    FeedFields fields;
+    EXPECT_TRUE(extract_feed_fields(json{{"near_earth_objects", json::object()}}, fields));
+    EXPECT_TRUE(fields.rows.empty());
+    EXPECT_EQ(fields.dateBegin.size(), 1u);
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,144 @@
+// tests/test_fetch_range.cpp
+
+#include <gtest/gtest.h>
+#include "src/get_data.h"
+#include "src/neo_dates.h"
+#include "local_http_server.h"
+#include "json.hpp"
+#include <algorithm>
+#include <chrono>
+
+using json = nlohmann::json;
+
+// Reads one query parameter out of a request target
+static std::string queryValue(const std::string& target, const std::string& name) {
+    size_t begin = target.find(name + "=");
+    if (begin == std::string::npos) return "";
+    begin += name.size() + 1;
+    return target.substr(begin, target.find('&', begin) - begin);
+}
+
+// Canned NeoWs feed with two NEOs per date of the requested window
+static std::string cannedFeed(const std::string& target) {
+    int64_t first = 0, last = 0;
+    if (!NeoDates::parseDate(queryValue(target, "start_date"), first) ||
+        !NeoDates::parseDate(queryValue(target, "end_date"), last)) {
+        return "{}";
+    }
+    json feed = {{"element_count", 0}, {"near_earth_objects", json::object()}};
+    for (int64_t day = first; day <= last; day++) {
+        std::string date = NeoDates::formatDate(day);
+        for (int i = 0; i < 2; i++) {
+            feed["near_earth_objects"][date].push_back({{"id", date + "-" + std::to_string(i)}, {"name", "NEO " + date}});
+        }
+        feed["element_count"] = feed["element_count"].get<int>() + 2;
+    }
+    return feed.dump();
+}
+
+static RangeFetchOptions localOptions(const LocalHttpServer& server, int maxParallel) {
+    RangeFetchOptions options;
+    options.baseUrl = server.url();
+    options.maxParallel = maxParallel;
+    return options;
+}
+
+// A month is split into 7-day windows and every date comes back exactly once
+TEST(FetchRangeTest, MergesAllWindows) {
+    LocalHttpServer server(cannedFeed);
+    json feed;
+    ASSERT_TRUE(fetch_neo_range(feed, "2024-09-01", "2024-09-30", "TEST_KEY", localOptions(server, 4)));
+
+    EXPECT_EQ(server.requestCount(), 5); // 7 + 7 + 7 + 7 + 2 days
+    ASSERT_EQ(feed["near_earth_objects"].size(), 30u);
+    EXPECT_EQ(feed["element_count"].get<int>(), 60);
+    EXPECT_TRUE(feed["near_earth_objects"].contains("2024-09-01"));
+    EXPECT_TRUE(feed["near_earth_objects"].contains("2024-09-30"));
+    EXPECT_EQ(feed["near_earth_objects"]["2024-09-15"].size(), 2u);
+
+    // Windows are set up through a FetchSession, so they ask for compression
+    std::string head = server.lastRequestHead();
+    std::transform(head.begin(), head.end(), head.begin(), ::tolower);
+    EXPECT_NE(head.find("accept-encoding:"), std::string::npos) << head;
+}
+
+// Windows run concurrently, but never more than the configured limit
+TEST(FetchRangeTest, RespectsParallelismLimit) {
+    const int latencyMs = 150;
+    LocalHttpServer server(cannedFeed, latencyMs);
+    json feed;
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(fetch_neo_range(feed, "2024-01-01", "2024-02-25", "TEST_KEY", localOptions(server, 4)));
+    double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(server.requestCount(), 8);
+    EXPECT_LE(server.peakConcurrentRequests(), 4);
+    EXPECT_GE(server.peakConcurrentRequests(), 2);
+    EXPECT_LT(elapsedMs, 8 * latencyMs * 0.75) << "Windows were fetched sequentially";
+    EXPECT_EQ(feed["near_earth_objects"].size(), 56u);
+}
+
+TEST(FetchRangeTest, SequentialWhenLimitIsOne) {
+    LocalHttpServer server(cannedFeed, 20);
+    json feed;
+    ASSERT_TRUE(fetch_neo_range(feed, "2024-01-01", "2024-01-21", "TEST_KEY", localOptions(server, 1)));
+    EXPECT_EQ(server.peakConcurrentRequests(), 1);
+    EXPECT_EQ(feed["near_earth_objects"].size(), 21u);
+}
+
+// A window with an invalid body fails the whole range
+TEST(FetchRangeTest, InvalidWindowFails) {
+    LocalHttpServer server([](const std::string& target) {
+        return queryValue(target, "start_date") == "2024-01-08" ? std::string("not json") : cannedFeed(target);
+    });
+    json feed;
+    EXPECT_FALSE(fetch_neo_range(feed, "2024-01-01", "2024-01-21", "TEST_KEY", localOptions(server, 2)));
+    EXPECT_TRUE(feed.is_null());
+}
+
+// An HTTP error fails the range, no further windows are requested, and the
+// API key in the request URL never reaches the log
+TEST(FetchRangeTest, HttpErrorStopsScheduling) {
+    for (int status : {429, 500}) {
+        LocalHttpServer server([status](const std::string& target) {
+            if (queryValue(target, "start_date") == "2024-01-08") {
+                return LocalHttpServer::Response{status, "{\"error\": \"rate limited\"}"};
+            }
+            return LocalHttpServer::Response{200, cannedFeed(target)};
+        });
+        json feed;
+        testing::internal::CaptureStderr();
+        EXPECT_FALSE(fetch_neo_range(feed, "2024-01-01", "2024-02-25", "SECRET_KEY", localOptions(server, 1)));
+        std::string log = testing::internal::GetCapturedStderr();
+
+        EXPECT_TRUE(feed.is_null());
+        EXPECT_EQ(server.requestCount(), 2) << status; // The failing second window is the last one sent
+        EXPECT_NE(log.find("HTTP " + std::to_string(status)), std::string::npos) << log;
+        EXPECT_NE(log.find("2024-01-08 to 2024-01-14"), std::string::npos) << log;
+        EXPECT_EQ(log.find("SECRET_KEY"), std::string::npos) << log;
+    }
+}
+
+TEST(FetchRangeTest, InvalidWindowKeepsKeyOutOfLog) {
+    LocalHttpServer server([](const std::string&) { return std::string("not json"); });
+    json feed;
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(fetch_neo_range(feed, "2024-01-01", "2024-01-07", "SECRET_KEY", localOptions(server, 1)));
+    std::string log = testing::internal::GetCapturedStderr();
+    EXPECT_NE(log.find("Invalid feed returned for 2024-01-01 to 2024-01-07"), std::string::npos) << log;
+    EXPECT_EQ(log.find("SECRET_KEY"), std::string::npos) << log;
+}
+
+TEST(FetchRangeTest, RejectsInvalidRange) {
+    json feed;
+    EXPECT_FALSE(fetch_neo_range(feed, "2024-02-01", "2024-01-01", "TEST_KEY"));
+    EXPECT_FALSE(fetch_neo_range(feed, "2024-13-01", "2024-12-01", "TEST_KEY"));
+    EXPECT_FALSE(fetch_neo_range(feed, "2024-1-5", "2024-01-09", "TEST_KEY"));
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
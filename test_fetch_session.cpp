@@ -0,0 +1,75 @@
+// tests/test_fetch_session.cpp
+
+#include <gtest/gtest.h>
+#include "src/fetch_session.h"
+#include "local_http_server.h"
+#include <algorithm>
+
+// Repeated requests travel over a single keep-alive connection
+TEST(FetchSessionTest, ReusesConnection) {
+    LocalHttpServer server([](const std::string& target) { return "{\"target\": \"" + target + "\"}"; });
+    FetchSession session;
+
+    for (int i = 0; i < 5; i++) {
+        std::string body;
+        ASSERT_TRUE(session.get(server.url("/feed?n=" + std::to_string(i)), body));
+        EXPECT_EQ(body, "{\"target\": \"/feed?n=" + std::to_string(i) + "\"}");
+        EXPECT_EQ(session.lastStatus(), 200);
+    }
+    EXPECT_EQ(server.requestCount(), 5);
+    EXPECT_EQ(server.connectionCount(), 1);
+}
+
+// Other handles configured from the session get its encodings and shared
+// DNS/TLS caches, but keep connections of their own
+TEST(FetchSessionTest, ConfiguredHandlesUseSessionSettings) {
+    LocalHttpServer server([](const std::string&) { return std::string("{}"); });
+    FetchSession session;
+    std::string body;
+    ASSERT_TRUE(session.get(server.url(), body));
+
+    for (int i = 0; i < 3; i++) {
+        CURL* curl = curl_easy_init();
+        session.configure(curl);
+        curl_easy_setopt(curl, CURLOPT_URL, server.url().c_str());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, +[](char*, size_t size, size_t count, void*) { return size * count; });
+        EXPECT_EQ(curl_easy_perform(curl), CURLE_OK);
+        curl_easy_cleanup(curl);
+
+        std::string head = server.lastRequestHead();
+        std::transform(head.begin(), head.end(), head.begin(), ::tolower);
+        EXPECT_NE(head.find("accept-encoding:"), std::string::npos);
+    }
+    EXPECT_EQ(server.requestCount(), 4);
+    EXPECT_EQ(server.connectionCount(), 4);
+}
+
+TEST(FetchSessionTest, AdvertisesCompression) {
+    LocalHttpServer server([](const std::string&) { return std::string("{}"); });
+    FetchSession session;
+    std::string body;
+    ASSERT_TRUE(session.get(server.url(), body));
+
+    std::string head = server.lastRequestHead();
+    std::transform(head.begin(), head.end(), head.begin(), ::tolower);
+    EXPECT_NE(head.find("accept-encoding:"), std::string::npos);
+    EXPECT_NE(head.find("gzip"), std::string::npos);
+}
+
+TEST(FetchSessionTest, ReportsTransportErrors) {
+    int port;
+    {
+        LocalHttpServer server([](const std::string&) { return std::string(); });
+        port = server.port();
+    }
+    FetchSession session;
+    std::string body = "stale";
+    EXPECT_FALSE(session.get("http://127.0.0.1:" + std::to_string(port) + "/feed", body));
+    EXPECT_TRUE(body.empty());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,68 @@
+// tests/test_get_data.cpp
+
+#include <gtest/gtest.h>
+#include "src/get_data.h"
+#include "src/mapped_file.h"
+#include "json.hpp"
+#include <fstream>
+
+using json = nlohmann::json;
+
+// The mapping exposes exactly the bytes of the file
+TEST(MappedFileTest, MapsWholeFile) {
+    std::ifstream file("data.json", std::ios::binary);
+    ASSERT_TRUE(file.is_open());
+    std::string expected((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    MappedFile mapped;
+    ASSERT_TRUE(mapped.open("data.json"));
+    ASSERT_EQ(mapped.size(), expected.size());
+    EXPECT_EQ(std::string(mapped.begin(), mapped.end()), expected);
+
+    MappedFile moved(std::move(mapped));
+    EXPECT_TRUE(moved.isOpen());
+    EXPECT_FALSE(mapped.isOpen());
+    EXPECT_EQ(moved.size(), expected.size());
+}
+
+TEST(MappedFileTest, MissingFileFails) {
+    MappedFile mapped;
+    EXPECT_FALSE(mapped.open("does_not_exist.json"));
+    EXPECT_FALSE(mapped.isOpen());
+    EXPECT_EQ(mapped.size(), 0u);
+}
+
+// The mmap-backed DOM path parses the same document as an ifstream
+TEST(LoadFromFileTest, MatchesStreamParse) {
+    std::ifstream file("data.json");
+    ASSERT_TRUE(file.is_open());
+    json expected;
+    file >> expected;
+
+    json loaded;
+    ASSERT_TRUE(load_from_file(loaded, "data.json"));
+    EXPECT_EQ(loaded, expected);
+}
+
+// Loading a single date keeps the feed layout but only that date's NEOs
+TEST(LoadFromFileTest, LoadsSingleDate) {
+    json full;
+    ASSERT_TRUE(load_from_file(full, "data.json"));
+
+    json partial;
+    ASSERT_TRUE(load_date_from_file(partial, "data.json", "2024-09-30"));
+    ASSERT_TRUE(partial.contains("near_earth_objects"));
+    EXPECT_EQ(partial["near_earth_objects"].size(), 1u);
+    EXPECT_EQ(partial["near_earth_objects"]["2024-09-30"], full["near_earth_objects"]["2024-09-30"]);
+    EXPECT_FALSE(partial.contains("links"));
+
+    json missing;
+    ASSERT_TRUE(load_date_from_file(missing, "data.json", "1999-01-01"));
+    EXPECT_TRUE(missing["near_earth_objects"].empty());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
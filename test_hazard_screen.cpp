@@ -0,0 +1,187 @@
+// tests/test_hazard_screen.cpp
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "src/body_physics.h"
+#include "src/feed_hydration.h"
+#include "src/get_data.h"
+#include "src/hazard_screen.h"
+#include "src/neo_stream.h"
+
+namespace {
+
+const int64_t reference = 1704067200000; // 2024-01-01T00:00Z
+const HazardCriterion criteria[] = {HazardCriterion::ImpactEnergy, HazardCriterion::MissDistance,
+                                    HazardCriterion::Palermo};
+
+void expectSameEntries(const std::vector<HazardEntry>& actual, const std::vector<HazardEntry>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        EXPECT_EQ(actual[i].id, expected[i].id) << i;
+        EXPECT_EQ(actual[i].name, expected[i].name) << i;
+        EXPECT_EQ(actual[i].epochMs, expected[i].epochMs) << i;
+        EXPECT_EQ(actual[i].impactEnergy, expected[i].impactEnergy) << i;
+        EXPECT_EQ(actual[i].missEarthRadii, expected[i].missEarthRadii) << i;
+        EXPECT_EQ(actual[i].palermo, expected[i].palermo) << i;
+    }
+}
+
+} // namespace
+
+class HazardScreenTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        json feed;
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+        ASSERT_TRUE(hydrate_feed(feed, asteroids, 1));
+        ASSERT_TRUE(table.loadFeed(feed, 1));
+    }
+    static AsteroidFeed asteroids;
+    static AsteroidTable table;
+};
+
+AsteroidFeed HazardScreenTest::asteroids;
+AsteroidTable HazardScreenTest::table;
+
+// The kept entries are the head of a full sort of every approach
+TEST_F(HazardScreenTest, TopMatchesFullSort) {
+    const size_t k = 5;
+    HazardScreen screen(k, reference);
+    HazardScreen everything(100000, reference);
+    for (const auto& asteroid : asteroids.asteroids) {
+        screen.add(asteroid);
+        everything.add(asteroid);
+    }
+    ASSERT_GT(screen.screened(), k);
+    EXPECT_EQ(screen.screened(), everything.screened());
+
+    for (HazardCriterion criterion : criteria) {
+        std::vector<HazardEntry> all = everything.top(criterion);
+        ASSERT_EQ(all.size(), everything.screened());
+        std::vector<HazardEntry> expected(all.begin(), all.begin() + k);
+        expectSameEntries(screen.top(criterion), expected);
+    }
+
+    std::vector<HazardEntry> energies = screen.top(HazardCriterion::ImpactEnergy);
+    std::vector<HazardEntry> misses = screen.top(HazardCriterion::MissDistance);
+    std::vector<HazardEntry> scores = screen.top(HazardCriterion::Palermo);
+    for (size_t i = 1; i < k; i++) {
+        EXPECT_GE(energies[i - 1].impactEnergy, energies[i].impactEnergy);
+        EXPECT_LE(misses[i - 1].missEarthRadii, misses[i].missEarthRadii);
+        EXPECT_GE(scores[i - 1].palermo, scores[i].palermo);
+    }
+    for (const auto& entry : everything.top(HazardCriterion::ImpactEnergy)) {
+        EXPECT_LE(entry.impactEnergy, energies[0].impactEnergy);
+        EXPECT_GE(entry.missEarthRadii, misses[0].missEarthRadii);
+    }
+}
+
+// Objects, tables, records and a stream from disk all screen the same, in any order
+TEST_F(HazardScreenTest, SourcesAndOrderAgree) {
+    HazardScreen fromAsteroids(4, reference);
+    for (const auto& asteroid : asteroids.asteroids) {
+        fromAsteroids.add(asteroid);
+    }
+    HazardScreen reversed(4, reference);
+    for (auto asteroid = asteroids.asteroids.rbegin(); asteroid != asteroids.asteroids.rend(); ++asteroid) {
+        reversed.add(*asteroid);
+    }
+    HazardScreen fromTable(4, reference);
+    fromTable.add(table);
+    HazardScreen fromStream(4, reference);
+    ASSERT_TRUE(stream_from_file("data.json", [&](const std::string&, const Asteroid& asteroid) {
+        fromStream.add(asteroid);
+    }));
+    HazardScreen fromRecords(4, reference);
+    ASSERT_TRUE(stream_records_from_file("data.json", [&](const std::string&, const json& neo) {
+        NeoFields fields;
+        extract_neo_fields(neo, fields);
+        fromRecords.add(fields);
+    }));
+
+    for (HazardCriterion criterion : criteria) {
+        std::vector<HazardEntry> expected = fromAsteroids.top(criterion);
+        expectSameEntries(reversed.top(criterion), expected);
+        expectSameEntries(fromTable.top(criterion), expected);
+        expectSameEntries(fromStream.top(criterion), expected);
+        expectSameEntries(fromRecords.top(criterion), expected);
+    }
+    EXPECT_EQ(fromStream.screened(), fromAsteroids.screened());
+    EXPECT_EQ(fromRecords.screened(), fromAsteroids.screened());
+}
+
+TEST_F(HazardScreenTest, KeepsAtMostCapacity) {
+    HazardScreen none(0, reference);
+    none.add(table);
+    EXPECT_GT(none.screened(), 0u);
+    for (HazardCriterion criterion : criteria) {
+        EXPECT_TRUE(none.top(criterion).empty());
+    }
+
+    HazardScreen one(1, reference);
+    for (int pass = 0; pass < 3; pass++) {
+        one.add(table);
+    }
+    for (HazardCriterion criterion : criteria) {
+        EXPECT_EQ(one.top(criterion).size(), 1u);
+    }
+    EXPECT_EQ(one.capacity(), 1u);
+}
+
+// Every source is screened on the reported miss distance, so approaches
+// inside the two radii an Asteroid floors its own distance at stay apart
+TEST(HazardMissDistanceTest, ScreensReportedMissDistance) {
+    double radius = BodyPhysics::earthRadiusKm;
+    std::vector<NeoFields> records(3);
+    const double reportedRadii[3] = {100, 1.5, 0.5};
+    for (int i = 0; i < 3; i++) {
+        records[i].id = std::to_string(2000001 + i);
+        records[i].minDiameterKm = records[i].maxDiameterKm = 0.1;
+        records[i].closeApproaches.push_back({NeoDate("2024-01-01"), 20.0, reportedRadii[i] * radius, reference});
+    }
+
+    HazardScreen fromRecords(3, reference);
+    HazardScreen fromAsteroids(3, reference);
+    AsteroidTable table;
+    for (const auto& record : records) {
+        fromRecords.add(record);
+        fromAsteroids.add(Asteroid(record));
+        table.append(record);
+    }
+    HazardScreen fromTable(3, reference);
+    fromTable.add(table);
+
+    std::vector<HazardEntry> misses = fromRecords.top(HazardCriterion::MissDistance);
+    ASSERT_EQ(misses.size(), 3u);
+    EXPECT_DOUBLE_EQ(misses[0].missEarthRadii, 0.5);
+    EXPECT_DOUBLE_EQ(misses[1].missEarthRadii, 1.5);
+    EXPECT_DOUBLE_EQ(misses[2].missEarthRadii, 100.0);
+    double energy = BodyPhysics::impactEnergy(BodyPhysics::asteroidMass(0.1, 0.1), 20.0);
+    EXPECT_EQ(misses[2].palermo, HazardScreen::palermoScore(energy, 100 * radius, 20.0, 1 / 365.25));
+    for (HazardCriterion criterion : criteria) {
+        expectSameEntries(fromAsteroids.top(criterion), fromRecords.top(criterion));
+        expectSameEntries(fromTable.top(criterion), fromRecords.top(criterion));
+    }
+}
+
+// An approach one year out, ten Earth radii away, at 20 km/s, with 1 MT of energy
+TEST(HazardScoreTest, PalermoScore) {
+    double radius = BodyPhysics::earthRadiusKm;
+    double focusing = 1 + std::pow(11.186 / 20.0, 2);
+    double probability = focusing / 100.0;
+    EXPECT_NEAR(HazardScreen::palermoScore(1.0, 10 * radius, 20.0, 1.0), std::log10(probability / 0.03), 1e-3);
+
+    // Ten times the energy is 10^0.8 times rarer in the background; twice as far is four times less likely
+    double score = HazardScreen::palermoScore(1.0, 10 * radius, 20.0, 1.0);
+    EXPECT_NEAR(HazardScreen::palermoScore(10.0, 10 * radius, 20.0, 1.0) - score, 0.8, 1e-12);
+    EXPECT_NEAR(score - HazardScreen::palermoScore(1.0, 20 * radius, 20.0, 1.0), std::log10(4.0), 1e-12);
+    EXPECT_NEAR(score - HazardScreen::palermoScore(1.0, 10 * radius, 20.0, 10.0), 1.0, 1e-12);
+    // A grazing approach cannot be more likely than certain
+    EXPECT_EQ(HazardScreen::palermoScore(1.0, radius, 5.0, 1.0), std::log10(1 / 0.03));
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,134 @@
+// tests/test_impact_matrix.cpp
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "src/body_physics.h"
+#include "src/classes.h"
+#include "src/get_data.h"
+#include "src/impact_matrix.h"
+
+class ImpactMatrixTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        json feed;
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+        ASSERT_TRUE(table.loadFeed(feed, 1));
+    }
+    static AsteroidTable table;
+};
+
+AsteroidTable ImpactMatrixTest::table;
+
+// Every cell is what the one-at-a-time formulas give
+TEST_F(ImpactMatrixTest, MatchesPerPairFormulas) {
+    ImpactMatrix matrix;
+    compute_impact_matrix(table, matrix, 1);
+    const auto& planets = SolarSystem::predefinedPlanets;
+    ASSERT_EQ(matrix.rows, table.size());
+    ASSERT_EQ(matrix.columns, planets.size());
+    ASSERT_EQ(matrix.energies.size(), table.size() * planets.size());
+    ASSERT_EQ(matrix.ids.size(), table.size());
+
+    for (size_t a = 0; a < table.size(); a++) {
+        EXPECT_EQ(matrix.ids[a], table.id(a));
+        double mass = table.mass()[a];
+        double approach = table.firstVelocityKmPerS(a);
+        for (size_t p = 0; p < planets.size(); p++) {
+            double velocity = matrix.value(ImpactQuantity::Velocity, a, p);
+            EXPECT_DOUBLE_EQ(velocity * velocity, approach * approach + planets[p].escapeVelocity * planets[p].escapeVelocity);
+            EXPECT_GT(velocity, planets[p].escapeVelocity);
+            EXPECT_EQ(matrix.value(ImpactQuantity::Energy, a, p), BodyPhysics::impactEnergy(mass, velocity));
+            EXPECT_EQ(matrix.value(ImpactQuantity::MassChange, a, p), -mass / planets[p].mass);
+        }
+    }
+}
+
+// The mass change is the one Planet::handleImpact applies
+TEST_F(ImpactMatrixTest, MassChangeMatchesHandleImpact) {
+    // The heaviest asteroid on the lightest planet, so the subtraction keeps enough digits
+    const auto& mercury = SolarSystem::predefinedPlanets[0];
+    json feed;
+    ASSERT_TRUE(load_from_file(feed, "data.json"));
+    std::vector<Asteroid> asteroids;
+    for (const auto& entry : feed["near_earth_objects"].items()) {
+        for (const auto& neo : entry.value()) {
+            asteroids.emplace_back(neo);
+        }
+    }
+    const Asteroid& asteroid = *std::max_element(asteroids.begin(), asteroids.end(),
+        [](const Asteroid& a, const Asteroid& b) { return a.getMass() < b.getMass(); });
+    Planet planet(mercury.name, mercury.diameter, mercury.mass);
+    testing::internal::CaptureStdout();
+    planet.handleImpact(asteroid);
+    testing::internal::GetCapturedStdout();
+
+    double mass = asteroid.getMass();
+    double velocity = asteroid.getCloseApproachData()[0].relative_velocity;
+    ImpactMatrix matrix;
+    compute_impact_matrix(&mass, &velocity, 1, matrix);
+    double expected = (planet.getMass() - mercury.mass) / mercury.mass;
+    EXPECT_NEAR(matrix.value(ImpactQuantity::MassChange, 0, 0), expected, std::fabs(expected) * 1e-3);
+}
+
+// Blocks may be computed by any thread without changing a bit
+TEST_F(ImpactMatrixTest, SameForAnyThreadCount) {
+    // More rows than one block, ending in a partial block
+    std::vector<double> masses, velocities;
+    for (int copy = 0; copy < 20; copy++) {
+        for (size_t a = 0; a < table.size(); a++) {
+            masses.push_back(table.mass()[a] * (1 + copy));
+            velocities.push_back(table.firstVelocityKmPerS(a) + copy);
+        }
+    }
+    ImpactMatrix reference;
+    compute_impact_matrix(masses.data(), velocities.data(), masses.size(), reference, 1);
+    EXPECT_TRUE(reference.ids.empty());
+    for (unsigned threads : {2u, 3u, 0u}) {
+        ImpactMatrix matrix;
+        compute_impact_matrix(masses.data(), velocities.data(), masses.size(), matrix, threads);
+        EXPECT_EQ(matrix.velocities, reference.velocities) << threads;
+        EXPECT_EQ(matrix.energies, reference.energies) << threads;
+        EXPECT_EQ(matrix.massChanges, reference.massChanges) << threads;
+    }
+
+    ImpactMatrix empty;
+    compute_impact_matrix(nullptr, nullptr, 0, empty);
+    EXPECT_EQ(empty.rows, 0u);
+    EXPECT_TRUE(empty.energies.empty());
+}
+
+TEST_F(ImpactMatrixTest, ExportsDenseCsv) {
+    ImpactMatrix matrix;
+    compute_impact_matrix(table, matrix);
+    std::string path = testing::TempDir() + "impact_matrix.csv";
+    ASSERT_TRUE(export_impact_matrix(matrix, ImpactQuantity::Energy, path));
+
+    std::ifstream in(path);
+    std::string line;
+    ASSERT_TRUE(std::getline(in, line));
+    EXPECT_EQ(line, "asteroid,Mercury,Venus,Earth,Mars,Jupiter,Saturn,Uranus,Neptune");
+    size_t rows = 0;
+    while (std::getline(in, line)) {
+        std::stringstream cells(line);
+        std::string cell;
+        ASSERT_TRUE(std::getline(cells, cell, ','));
+        EXPECT_EQ(cell, matrix.ids[rows]);
+        for (size_t p = 0; p < matrix.columns; p++) {
+            ASSERT_TRUE(std::getline(cells, cell, ','));
+            EXPECT_EQ(std::stod(cell), matrix.value(ImpactQuantity::Energy, rows, p)); // Round-trips exactly
+        }
+        EXPECT_FALSE(std::getline(cells, cell, ','));
+        rows++;
+    }
+    EXPECT_EQ(rows, matrix.rows);
+
+    EXPECT_FALSE(export_impact_matrix(matrix, ImpactQuantity::Energy, "/nonexistent/dir/matrix.csv"));
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+// tests/test_impact_monte_carlo.cpp
+
+#include <gtest/gtest.h>
+#include "src/body_physics.h"
+#include "src/get_data.h"
+#include "src/impact_monte_carlo.h"
+
+class ImpactMonteCarloTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        json feed;
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+        ASSERT_TRUE(table.loadFeed(feed, 1));
+        bodies = ImpactMonteCarlo::bodiesOf(table);
+    }
+    static AsteroidTable table;
+    static std::vector<ImpactBody> bodies;
+};
+
+AsteroidTable ImpactMonteCarloTest::table;
+std::vector<ImpactBody> ImpactMonteCarloTest::bodies;
+
+// The same bits whatever the number of threads
+TEST_F(ImpactMonteCarloTest, ReproducibleAcrossThreadCounts) {
+    ImpactUncertainty model;
+    model.samples = 2000;
+    model.percentiles = {0, 5, 25, 50, 75, 95, 99.9, 100};
+    ImpactMonteCarlo engine(model);
+
+    ImpactEnergyStats reference;
+    engine.run(bodies, reference, 1);
+    ASSERT_EQ(reference.size(), bodies.size());
+    ASSERT_EQ(reference.energies.size(), bodies.size() * 8);
+    for (unsigned threads : {2u, 3u, 8u, 0u}) {
+        ImpactEnergyStats stats;
+        engine.run(bodies, stats, threads);
+        EXPECT_EQ(stats.means, reference.means) << threads;
+        EXPECT_EQ(stats.energies, reference.energies) << threads;
+    }
+
+    EXPECT_EQ(engine.sample(bodies[3], 3, 17), engine.sample(bodies[3], 3, 17));
+    EXPECT_NE(engine.sample(bodies[3], 3, 17), engine.sample(bodies[3], 3, 18));
+    EXPECT_NE(engine.sample(bodies[3], 3, 17), engine.sample(bodies[3], 4, 17));
+}
+
+// Percentiles are ordered, bounded by the extremes, and spread around the
+// single number Asteroid reports
+TEST_F(ImpactMonteCarloTest, PercentilesBracketNominalEnergy) {
+    ImpactUncertainty model;
+    model.samples = 5000;
+    model.percentiles = {0, 5, 50, 95, 100};
+    ImpactEnergyStats stats;
+    ImpactMonteCarlo(model).run(bodies, stats);
+
+    size_t bracketed = 0;
+    for (size_t i = 0; i < stats.size(); i++) {
+        for (size_t p = 1; p < 5; p++) {
+            EXPECT_LE(stats.energy(i, p - 1), stats.energy(i, p));
+        }
+        EXPECT_GT(stats.energy(i, 0), 0.0);
+        EXPECT_GT(stats.means[i], stats.energy(i, 0));
+        EXPECT_LT(stats.means[i], stats.energy(i, 4));
+        double nominal = table[i].calculateImpactEnergy();
+        bracketed += stats.energy(i, 1) < nominal && nominal < stats.energy(i, 3);
+    }
+    EXPECT_EQ(bracketed, stats.size());
+}
+
+// With nothing uncertain every sample is the deterministic energy
+TEST_F(ImpactMonteCarloTest, CertainInputsGiveNominalEnergy) {
+    ImpactUncertainty model;
+    model.samples = 101;
+    model.densityMin = model.densityMax = BodyPhysics::asteroidDensity;
+    model.velocitySigma = 0;
+    model.percentiles = {0, 37.5, 100};
+    ImpactBody body{0.8, 0.8, 14.5};
+    ImpactEnergyStats stats;
+    ImpactMonteCarlo(model).run({body}, stats, 2);
+
+    double nominal = BodyPhysics::impactEnergy(BodyPhysics::asteroidMass(0.8, 0.8), 14.5);
+    for (double energy : stats.energies) {
+        EXPECT_NEAR(energy, nominal, nominal * 1e-12);
+    }
+    EXPECT_NEAR(stats.means[0], nominal, nominal * 1e-12);
+}
+
+TEST_F(ImpactMonteCarloTest, RejectsInvalidModels) {
+    ImpactUncertainty model;
+    model.samples = 0;
+    EXPECT_THROW(ImpactMonteCarlo{model}, std::invalid_argument);
+    model = ImpactUncertainty();
+    model.densityMin = 4000;
+    model.densityMax = 2000;
+    EXPECT_THROW(ImpactMonteCarlo{model}, std::invalid_argument);
+    model = ImpactUncertainty();
+    model.percentiles = {50, 5};
+    EXPECT_THROW(ImpactMonteCarlo{model}, std::invalid_argument);
+    model.percentiles = {101};
+    EXPECT_THROW(ImpactMonteCarlo{model}, std::invalid_argument);
+
+    ImpactEnergyStats stats;
+    ImpactMonteCarlo().run({}, stats);
+    EXPECT_EQ(stats.size(), 0u);
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
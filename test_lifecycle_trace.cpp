@@ -0,0 +1,122 @@
+// tests/test_lifecycle_trace.cpp
+
+#include <gtest/gtest.h>
+#include "src/classes.h"
+#include "src/lifecycle_trace.h"
+#include <sstream>
+#include <thread>
+
+#if SPACE_BODY_TRACE
+
+class LifecycleTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        LifecycleTrace::clear();
+    }
+    void TearDown() override {
+        LifecycleTrace::setLevel(TraceLevel::Off);
+        LifecycleTrace::clear();
+    }
+
+    static NeoFields eros() {
+        NeoFields fields;
+        fields.id = "2000433";
+        fields.name = "433 Eros (A898 PA)";
+        fields.minDiameterKm = 16.8;
+        fields.maxDiameterKm = 37.6;
+        fields.closeApproaches.push_back({"2025-11-30", 5.9, 59.7e6});
+        return fields;
+    }
+};
+
+TEST_F(LifecycleTraceTest, RecordsCopiesAndDestructions) {
+    LifecycleTrace::setLevel(TraceLevel::Lifecycle);
+    {
+        Asteroid original(eros());
+        Asteroid copy(original);
+    }
+    auto records = LifecycleTrace::snapshot();
+    ASSERT_EQ(records.size(), 5u);
+    EXPECT_EQ(records[0].body, TraceBody::Asteroid);
+    EXPECT_EQ(records[0].event, TraceEvent::Copied);
+    EXPECT_EQ(records[0].name, "433 Eros (A898 PA)");
+    // The copy goes first, each as Asteroid then as SpaceBody
+    EXPECT_EQ(records[1].body, TraceBody::Asteroid);
+    EXPECT_EQ(records[1].event, TraceEvent::Destroyed);
+    EXPECT_EQ(records[2].body, TraceBody::SpaceBody);
+    EXPECT_EQ(records[2].event, TraceEvent::Destroyed);
+    EXPECT_EQ(records[4].sequence, 4u);
+    EXPECT_LE(records[0].nanoseconds, records[4].nanoseconds);
+}
+
+TEST_F(LifecycleTraceTest, LevelsFilterEvents) {
+    { Planet earth("Earth", 12742, 5.972e24); }
+    EXPECT_EQ(LifecycleTrace::recorded(), 0u);
+
+    LifecycleTrace::setLevel(TraceLevel::Verbose);
+    { Planet earth("Earth", 12742, 5.972e24); }
+    auto records = LifecycleTrace::snapshot();
+    ASSERT_EQ(records.size(), 4u);
+    EXPECT_EQ(records[0].event, TraceEvent::Constructed);
+    EXPECT_EQ(records[0].body, TraceBody::SpaceBody);
+    EXPECT_EQ(records[1].event, TraceEvent::Constructed);
+    EXPECT_EQ(records[1].body, TraceBody::Planet);
+    EXPECT_EQ(records[2].body, TraceBody::Planet);
+    EXPECT_EQ(records[2].event, TraceEvent::Destroyed);
+
+    std::ostringstream out;
+    LifecycleTrace::dump(out);
+    EXPECT_EQ(out.str(),
+              "#0 Space body Earth constructed\n"
+              "#1 Planet Earth constructed\n"
+              "#2 Planet Earth destroyed\n"
+              "#3 Space body Earth destroyed\n");
+}
+
+// A full ring keeps the newest events; long names are truncated
+TEST_F(LifecycleTraceTest, RingKeepsNewestEvents) {
+    LifecycleTrace::setLevel(TraceLevel::Lifecycle);
+    size_t total = LifecycleTrace::capacity + 100;
+    for (size_t i = 0; i < total; i++) {
+        LifecycleTrace::record(TraceBody::Asteroid, TraceEvent::Destroyed, std::to_string(i));
+    }
+    LifecycleTrace::record(TraceBody::Asteroid, TraceEvent::Destroyed, std::string(100, 'x'));
+
+    auto records = LifecycleTrace::snapshot();
+    ASSERT_EQ(records.size(), LifecycleTrace::capacity);
+    EXPECT_EQ(records.front().sequence, total + 1 - LifecycleTrace::capacity);
+    EXPECT_EQ(records.front().name, std::to_string(total + 1 - LifecycleTrace::capacity));
+    EXPECT_EQ(records.back().name, std::string(LifecycleTrace::maxNameLength, 'x'));
+    EXPECT_EQ(LifecycleTrace::recorded(), total + 1);
+}
+
+TEST_F(LifecycleTraceTest, ConcurrentWritersLoseNothing) {
+    LifecycleTrace::setLevel(TraceLevel::Lifecycle);
+    const int threads = 4;
+    const int perThread = 500;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threads; t++) {
+        writers.emplace_back([t] {
+            for (int i = 0; i < perThread; i++) {
+                LifecycleTrace::record(TraceBody::Planet, TraceEvent::Destroyed, "writer " + std::to_string(t));
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+
+    auto records = LifecycleTrace::snapshot();
+    ASSERT_EQ(records.size(), size_t(threads * perThread));
+    std::vector<int> perWriter(threads, 0);
+    for (const auto& record : records) {
+        perWriter[record.name.back() - '0']++;
+    }
+    for (int count : perWriter) EXPECT_EQ(count, perThread);
+}
+
+#endif // SPACE_BODY_TRACE
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,161 @@
+// tests/test_neo_fields.cpp
+
+#include <gtest/gtest.h>
+#include "src/neo_fields.h"
+#include "src/get_data.h"
+#include <stdexcept>
+
+static json sampleNeo() {
+    return json::parse(R"json({
+        "links": {"self": "http://api.nasa.gov/neo/rest/v1/neo/12345"},
+        "id": "12345",
+        "neo_reference_id": "12345",
+        "name": "(2024 AB)",
+        "nasa_jpl_url": "https://ssd.jpl.nasa.gov/tools/sbdb_lookup.html#/?sstr=12345",
+        "absolute_magnitude_h": 21.5,
+        "estimated_diameter": {
+            "kilometers": {"estimated_diameter_min": 0.2, "estimated_diameter_max": 0.4},
+            "meters": {"estimated_diameter_min": 200.0, "estimated_diameter_max": 400.0}
+        },
+        "is_potentially_hazardous_asteroid": true,
+        "close_approach_data": [
+            {"close_approach_date": "2024-10-10",
+             "relative_velocity": {"kilometers_per_second": "12.5", "kilometers_per_hour": "45000"},
+             "miss_distance": {"astronomical": "0.02", "kilometers": "3000000"},
+             "orbiting_body": "Earth"},
+            {"close_approach_date": "2031-04-02",
+             "relative_velocity": {"kilometers_per_second": "9.25"},
+             "miss_distance": {"kilometers": "7500000.5"},
+             "orbiting_body": "Mars"}
+        ],
+        "is_sentry_object": false
+    })json");
+}
+
+TEST(NeoFieldsTest, ExtractsEveryField) {
+    NeoFields fields;
+    extract_neo_fields(sampleNeo(), fields);
+
+    EXPECT_EQ(fields.id, "12345");
+    EXPECT_EQ(fields.name, "(2024 AB)");
+    EXPECT_EQ(fields.nasaJplUrl, "https://ssd.jpl.nasa.gov/tools/sbdb_lookup.html#/?sstr=12345");
+    EXPECT_DOUBLE_EQ(fields.absoluteMagnitude, 21.5);
+    EXPECT_DOUBLE_EQ(fields.minDiameterKm, 0.2);
+    EXPECT_DOUBLE_EQ(fields.maxDiameterKm, 0.4);
+    EXPECT_TRUE(fields.potentiallyHazardous);
+    ASSERT_EQ(fields.closeApproaches.size(), 2u);
+    EXPECT_EQ(fields.closeApproaches[0].date, "2024-10-10");
+    EXPECT_DOUBLE_EQ(fields.closeApproaches[0].relative_velocity, 12.5);
+    EXPECT_DOUBLE_EQ(fields.closeApproaches[0].miss_distance, 3000000.0);
+    EXPECT_EQ(fields.closeApproaches[1].date, "2031-04-02");
+    EXPECT_DOUBLE_EQ(fields.closeApproaches[1].relative_velocity, 9.25);
+    EXPECT_DOUBLE_EQ(fields.closeApproaches[1].miss_distance, 7500000.5);
+}
+
+// Every NEO in data.json gives the values a direct lookup gives
+TEST(NeoFieldsTest, MatchesDirectLookupOnDataFile) {
+    json feed;
+    ASSERT_TRUE(load_from_file(feed, "data.json"));
+    NeoFields fields;
+    size_t count = 0;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            extract_neo_fields(neo, fields); // Reused, as a loader would
+            const auto& km = neo["estimated_diameter"]["kilometers"];
+            EXPECT_EQ(fields.id, neo["id"].get<std::string>());
+            EXPECT_EQ(fields.name, neo["name"].get<std::string>());
+            EXPECT_EQ(fields.nasaJplUrl, neo["nasa_jpl_url"].get<std::string>());
+            EXPECT_EQ(fields.absoluteMagnitude, neo["absolute_magnitude_h"].get<double>());
+            EXPECT_EQ(fields.minDiameterKm, km["estimated_diameter_min"].get<double>());
+            EXPECT_EQ(fields.maxDiameterKm, km["estimated_diameter_max"].get<double>());
+            EXPECT_EQ(fields.potentiallyHazardous, neo["is_potentially_hazardous_asteroid"].get<bool>());
+            ASSERT_EQ(fields.closeApproaches.size(), neo["close_approach_data"].size());
+            for (size_t i = 0; i < fields.closeApproaches.size(); i++) {
+                const auto& approach = neo["close_approach_data"][i];
+                EXPECT_EQ(fields.closeApproaches[i].date, approach["close_approach_date"].get<std::string>());
+                EXPECT_EQ(fields.closeApproaches[i].relative_velocity,
+                          std::stod(approach["relative_velocity"]["kilometers_per_second"].get<std::string>()));
+                EXPECT_EQ(fields.closeApproaches[i].miss_distance,
+                          std::stod(approach["miss_distance"]["kilometers"].get<std::string>()));
+            }
+            count++;
+        }
+    }
+    EXPECT_EQ(count, feed["element_count"].get<size_t>());
+}
+
+TEST(NeoFieldsTest, MissingFieldNamesItsPath) {
+    json neo = sampleNeo();
+    neo["estimated_diameter"]["kilometers"].erase("estimated_diameter_max");
+    NeoFields fields;
+    try {
+        extract_neo_fields(neo, fields);
+        FAIL() << "Expected out_of_range";
+    } catch (const std::out_of_range& e) {
+        EXPECT_NE(std::string(e.what()).find("estimated_diameter.kilometers.estimated_diameter_max"), std::string::npos);
+    }
+
+    neo = sampleNeo();
+    neo["close_approach_data"][1]["miss_distance"].erase("kilometers");
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::out_of_range);
+
+    neo = sampleNeo();
+    neo.erase("id");
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::out_of_range);
+}
+
+TEST(NeoFieldsTest, WrongTypeIsRejected) {
+    NeoFields fields;
+    json neo = sampleNeo();
+    neo["absolute_magnitude_h"] = "21.5";
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::invalid_argument);
+
+    neo = sampleNeo();
+    neo["close_approach_data"] = json::object();
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::invalid_argument);
+
+    neo = sampleNeo();
+    neo["close_approach_data"][0]["relative_velocity"]["kilometers_per_second"] = "fast";
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::invalid_argument);
+
+    neo = sampleNeo();
+    neo["close_approach_data"][0]["close_approach_date"] = "2024-Oct-10";
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::invalid_argument);
+
+    EXPECT_THROW(extract_neo_fields(json::array(), fields), std::invalid_argument);
+}
+
+// The exact epoch is preferred, then the full date, then midnight of the day
+TEST(NeoFieldsTest, CloseApproachEpochs) {
+    NeoFields fields;
+    json neo = sampleNeo();
+    neo["close_approach_data"][0]["close_approach_date_full"] = "2024-Oct-10 02:06";
+    neo["close_approach_data"][1]["close_approach_date_full"] = "2031-Apr-02 23:59";
+    neo["close_approach_data"][1]["epoch_date_close_approach"] = 1932940799000; // 23:59:59
+    extract_neo_fields(neo, fields);
+    EXPECT_EQ(fields.closeApproaches[0].epochMs, 1728525960000);
+    EXPECT_EQ(fields.closeApproaches[1].epochMs, 1932940799000);
+
+    extract_neo_fields(sampleNeo(), fields);
+    EXPECT_EQ(fields.closeApproaches[0].epochMs, 1728518400000);
+
+    neo["close_approach_data"][0]["close_approach_date_full"] = "2024-10-10 02:06";
+    EXPECT_THROW(extract_neo_fields(neo, fields), std::invalid_argument);
+}
+
+// A reused struct does not keep close approaches from the previous object
+TEST(NeoFieldsTest, ReuseReplacesCloseApproaches) {
+    NeoFields fields;
+    extract_neo_fields(sampleNeo(), fields);
+    json neo = sampleNeo();
+    neo["close_approach_data"].erase(1);
+    extract_neo_fields(neo, fields);
+    ASSERT_EQ(fields.closeApproaches.size(), 1u);
+    EXPECT_EQ(fields.closeApproaches[0].date, "2024-10-10");
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
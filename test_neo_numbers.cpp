@@ -0,0 +1,129 @@
+// tests/test_neo_numbers.cpp
+
+#include <gtest/gtest.h>
+#include "src/neo_numbers.h"
+#include "src/get_data.h"
+#include <clocale>
+#include <cstdlib>
+
+TEST(NeoNumbersTest, DecodesNeoWsNumbers) {
+    double value = 0;
+    EXPECT_TRUE(decode_number("19.7506484939", value));
+    EXPECT_DOUBLE_EQ(value, 19.7506484939);
+    EXPECT_TRUE(decode_number("63953842.156602479", value));
+    EXPECT_DOUBLE_EQ(value, 63953842.156602479);
+    EXPECT_TRUE(decode_number("0", value));
+    EXPECT_EQ(value, 0.0);
+    EXPECT_TRUE(decode_number("-1.5e3", value));
+    EXPECT_EQ(value, -1500.0);
+}
+
+TEST(NeoNumbersTest, RejectsAnythingButOneNumber) {
+    const char* bad[] = {"", " 1.0", "1.0 ", "+1.0", "1.0km", "1,5", "fast", "inf", "nan", "0x1p3", "1e400"};
+    for (const char* text : bad) {
+        double value = 42;
+        const char* reason = nullptr;
+        EXPECT_FALSE(decode_number(text, value, &reason)) << '"' << text << '"';
+        EXPECT_NE(reason, nullptr) << '"' << text << '"';
+        EXPECT_EQ(value, 42) << "value changed for \"" << text << '"';
+    }
+    double value;
+    const char* reason = nullptr;
+    decode_number("1e400", value, &reason);
+    EXPECT_STREQ(reason, "is out of range");
+    decode_number("12.5 ", value, &reason);
+    EXPECT_STREQ(reason, "has trailing characters");
+}
+
+// Decoding must not follow the C locale's decimal separator
+TEST(NeoNumbersTest, IgnoresLocale) {
+    const char* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8"};
+    const char* previous = std::setlocale(LC_NUMERIC, nullptr);
+    std::string saved = previous ? previous : "C";
+    bool switched = false;
+    for (const char* name : locales) {
+        if (std::setlocale(LC_NUMERIC, name)) {
+            switched = true;
+            break;
+        }
+    }
+    if (!switched) {
+        GTEST_SKIP() << "No locale with a decimal comma is installed";
+    }
+    double value = 0;
+    bool ok = decode_number("12.25", value);
+    std::setlocale(LC_NUMERIC, saved.c_str());
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(value, 12.25);
+}
+
+// Every unit of every close approach in data.json matches strtod
+TEST(NeoNumbersTest, DecodesAllUnitsOfDataFile) {
+    json feed;
+    ASSERT_TRUE(load_from_file(feed, "data.json"));
+    size_t approaches = 0;
+    for (const auto& date : feed["near_earth_objects"].items()) {
+        for (const auto& neo : date.value()) {
+            const json& data = neo["close_approach_data"];
+            std::vector<ApproachNumbers> numbers;
+            NumberError error;
+            ASSERT_TRUE(decode_close_approaches(data, numbers, &error)) << error.field << " " << error.reason;
+            ASSERT_EQ(numbers.size(), data.size());
+            for (size_t i = 0; i < numbers.size(); i++) {
+                auto expect = [&](const char* group, const char* unit) {
+                    return std::strtod(data[i][group][unit].get<std::string>().c_str(), nullptr);
+                };
+                EXPECT_EQ(numbers[i].velocityKmPerS, expect("relative_velocity", "kilometers_per_second"));
+                EXPECT_EQ(numbers[i].velocityKmPerH, expect("relative_velocity", "kilometers_per_hour"));
+                EXPECT_EQ(numbers[i].velocityMilesPerH, expect("relative_velocity", "miles_per_hour"));
+                EXPECT_EQ(numbers[i].missAstronomical, expect("miss_distance", "astronomical"));
+                EXPECT_EQ(numbers[i].missLunar, expect("miss_distance", "lunar"));
+                EXPECT_EQ(numbers[i].missKm, expect("miss_distance", "kilometers"));
+                EXPECT_EQ(numbers[i].missMiles, expect("miss_distance", "miles"));
+            }
+            approaches += numbers.size();
+        }
+    }
+    EXPECT_GT(approaches, 0u);
+}
+
+TEST(NeoNumbersTest, ReportsWhereABatchFailed) {
+    json approach = {
+        {"relative_velocity", {{"kilometers_per_second", "5.0"}, {"kilometers_per_hour", "18000"},
+                               {"miles_per_hour", "11184.7"}}},
+        {"miss_distance", {{"astronomical", "0.01"}, {"lunar", "3.9"}, {"kilometers", "1495978"},
+                           {"miles", "929558"}}}
+    };
+    json batch = json::array({approach, approach, approach});
+    batch[2]["miss_distance"]["lunar"] = "3,9";
+
+    std::vector<ApproachNumbers> numbers;
+    NumberError error;
+    EXPECT_FALSE(decode_close_approaches(batch, numbers, &error));
+    EXPECT_EQ(numbers.size(), 2u);
+    EXPECT_EQ(error.record, 2u);
+    EXPECT_EQ(error.field, "miss_distance.lunar");
+    EXPECT_EQ(error.text, "3,9");
+    EXPECT_EQ(error.reason, "has trailing characters");
+
+    batch[2] = approach;
+    batch[1]["relative_velocity"].erase("miles_per_hour");
+    numbers.clear();
+    EXPECT_FALSE(decode_close_approaches(batch, numbers, &error));
+    EXPECT_EQ(error.record, 1u);
+    EXPECT_EQ(error.field, "relative_velocity.miles_per_hour");
+    EXPECT_EQ(error.reason, "is missing");
+
+    batch[1] = approach;
+    batch[0]["miss_distance"]["kilometers"] = 1495978;
+    numbers.clear();
+    EXPECT_FALSE(decode_close_approaches(batch, numbers, &error));
+    EXPECT_EQ(error.record, 0u);
+    EXPECT_EQ(error.reason, "is not a string");
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
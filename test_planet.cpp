@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include "src/planets.h"
 #include "src/classes.h"
+#include "src/body_physics.h"
 #include "json.hpp"
 
 using json = nlohmann::json;
@@ -76,6 +77,36 @@ TEST_F(PlanetTest, CalculateEscapeVelocity_ExtremeValues) {
     EXPECT_GT(escapeVelocityGiant, escapeVelocityTiny);
 }
 
+// The compile-time table holds what Planet computes at run time
+TEST_F(PlanetTest, PredefinedPlanetsMatchPlanetClass) {
+    static_assert(SolarSystem::predefinedPlanets.size() == 8, "Eight planets");
+    constexpr double jupiterGravity = SolarSystem::predefinedPlanets[4].surfaceGravity;
+    static_assert(jupiterGravity > SolarSystem::predefinedPlanets[2].surfaceGravity, "Usable in constant expressions");
+
+    for (const PlanetData& data : SolarSystem::predefinedPlanets) {
+        Planet planet(data.name, data.diameter, data.mass);
+        EXPECT_EQ(data.surfaceGravity, planet.calculateSurfaceGravity()) << data.name;
+        EXPECT_DOUBLE_EQ(data.escapeVelocity, planet.calculateEscapeVelocity()) << data.name;
+    }
+    EXPECT_DOUBLE_EQ(BodyPhysics::compileTimeSqrt(2.0), std::sqrt(2.0));
+    EXPECT_EQ(BodyPhysics::compileTimeSqrt(0.0), 0.0);
+    EXPECT_EQ(BodyPhysics::compileTimeSqrt(1e-300), std::sqrt(1e-300));
+}
+
+// A table entry prints the same lines as the Planet built from it
+TEST_F(PlanetTest, PrintsLikePredefinedPlanet) {
+    for (const PlanetData& data : SolarSystem::predefinedPlanets) {
+        Planet planet(data.name, data.diameter, data.mass);
+        testing::internal::CaptureStdout();
+        planet.printInfo();
+        std::string fromPlanet = testing::internal::GetCapturedStdout();
+        testing::internal::CaptureStdout();
+        printPlanetData(data);
+        EXPECT_EQ(testing::internal::GetCapturedStdout(), fromPlanet) << data.name;
+        EXPECT_EQ(fromPlanet.rfind("Planet Name: " + std::string(data.name) + ",", 0), 0u) << fromPlanet;
+    }
+}
+
 // Test Planet's handleImpact method (Assuming it's implemented)
 TEST_F(PlanetTest, HandleImpact) {
     // Initialize Earth
@@ -122,6 +153,24 @@ TEST_F(PlanetTest, HandleImpact) {
     EXPECT_DOUBLE_EQ(earth.getMass(), expectedMass);
 }
 
+// Gravity and escape velocity are recomputed when an impact changes the mass
+TEST_F(PlanetTest, HandleImpactUpdatesDerivedQuantities) {
+    Planet moon("Moon", 3474.8, 7.342e22);
+    NeoFields fields;
+    fields.id = "1";
+    fields.name = "Huge";
+    fields.minDiameterKm = 900.0;
+    fields.maxDiameterKm = 1100.0;
+    fields.closeApproaches.push_back({"2025-01-01", 20.0, 1.0e6});
+    Asteroid asteroid(fields);
+    double gravityBefore = moon.calculateSurfaceGravity();
+
+    moon.handleImpact(asteroid);
+    EXPECT_LT(moon.calculateSurfaceGravity(), gravityBefore);
+    EXPECT_EQ(moon.calculateSurfaceGravity(), BodyPhysics::surfaceGravity(moon.getDiameter(), moon.getMass()));
+    EXPECT_EQ(moon.calculateEscapeVelocity(), BodyPhysics::escapeVelocity(moon.getDiameter(), moon.getMass()));
+}
+
 // Main function for running tests
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,155 @@
+// tests/test_response_cache.cpp
+
+#include <gtest/gtest.h>
+#include "src/get_data.h"
+#include "src/response_cache.h"
+#include "local_http_server.h"
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class ResponseCacheTest : public ::testing::Test {
+protected:
+    const std::string directory = "test_neo_cache";
+    time_t now = 1727740800; // 2024-10-01 00:00 UTC
+
+    void SetUp() override { fs::remove_all(directory); }
+    void TearDown() override { fs::remove_all(directory); }
+
+    ResponseCacheOptions options() {
+        ResponseCacheOptions cacheOptions;
+        cacheOptions.directory = directory;
+        cacheOptions.clock = [this] { return now; };
+        return cacheOptions;
+    }
+};
+
+TEST_F(ResponseCacheTest, StoresAndFindsByEndpointAndRange) {
+    ResponseCache cache(options());
+    std::string body;
+    EXPECT_FALSE(cache.lookup("https://a/feed", "2020-01-01", "2020-01-07", body));
+
+    cache.store("https://a/feed", "2020-01-01", "2020-01-07", "{\"week\": 1}");
+    ASSERT_TRUE(cache.lookup("https://a/feed", "2020-01-01", "2020-01-07", body));
+    EXPECT_EQ(body, "{\"week\": 1}");
+
+    EXPECT_FALSE(cache.lookup("https://b/feed", "2020-01-01", "2020-01-07", body));
+    EXPECT_FALSE(cache.lookup("https://a/feed", "2020-01-01", "2020-01-06", body));
+}
+
+// Historical ranges never expire, recent ones only live for the TTL
+TEST_F(ResponseCacheTest, RecentRangesExpire) {
+    ResponseCache cache(options());
+    cache.store("feed", "2020-01-01", "2020-01-01", "old");
+    cache.store("feed", "2024-09-30", "2024-09-30", "recent");
+
+    now += 7 * 24 * 3600;
+    std::string body;
+    EXPECT_TRUE(cache.lookup("feed", "2020-01-01", "2020-01-01", body));
+    EXPECT_FALSE(cache.lookup("feed", "2024-09-30", "2024-09-30", body));
+}
+
+TEST_F(ResponseCacheTest, RecentRangesAreFreshWithinTtl) {
+    ResponseCache cache(options());
+    cache.store("feed", "2024-09-30", "2024-09-30", "recent");
+    now += 60;
+    std::string body;
+    EXPECT_TRUE(cache.lookup("feed", "2024-09-30", "2024-09-30", body));
+    EXPECT_EQ(body, "recent");
+}
+
+// Writes leave no temporary files behind
+TEST_F(ResponseCacheTest, WritesAreAtomic) {
+    ResponseCache cache(options());
+    cache.store("feed", "2020-01-01", "2020-01-01", "first");
+    cache.store("feed", "2020-01-01", "2020-01-01", "second");
+
+    int files = 0;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        EXPECT_EQ(entry.path().extension(), ".json");
+        files++;
+    }
+    EXPECT_EQ(files, 1);
+    std::string body;
+    ASSERT_TRUE(cache.lookup("feed", "2020-01-01", "2020-01-01", body));
+    EXPECT_EQ(body, "second");
+}
+
+// The least recently used entry goes first once the size limit is hit
+TEST_F(ResponseCacheTest, EvictsLeastRecentlyUsed) {
+    ResponseCacheOptions cacheOptions = options();
+    cacheOptions.maxBytes = 3 * 1100;
+    ResponseCache cache(cacheOptions);
+    std::string payload(1000, 'x');
+    std::string body;
+
+    cache.store("feed", "2020-01-01", "2020-01-01", payload);
+    fs::last_write_time(fs::directory_iterator(directory)->path(), fs::file_time_type::clock::now() - std::chrono::hours(2));
+    cache.store("feed", "2020-01-02", "2020-01-02", payload);
+    cache.store("feed", "2020-01-03", "2020-01-03", payload);
+    ASSERT_TRUE(cache.lookup("feed", "2020-01-01", "2020-01-01", body)); // Now the most recently used
+    cache.store("feed", "2020-01-04", "2020-01-04", payload);
+
+    EXPECT_LE(cache.sizeOnDisk(), cacheOptions.maxBytes);
+    EXPECT_TRUE(cache.lookup("feed", "2020-01-01", "2020-01-01", body));
+    EXPECT_TRUE(cache.lookup("feed", "2020-01-04", "2020-01-04", body));
+    int remaining = cache.lookup("feed", "2020-01-02", "2020-01-02", body) + cache.lookup("feed", "2020-01-03", "2020-01-03", body);
+    EXPECT_EQ(remaining, 1);
+}
+
+// Temporary files left by a crashed writer are removed once stale; ones that
+// may still be in use are kept but count toward the size limit
+TEST_F(ResponseCacheTest, EvictsStaleTemporaryFiles) {
+    ResponseCacheOptions cacheOptions = options();
+    cacheOptions.maxBytes = 3 * 1100;
+    ResponseCache cache(cacheOptions);
+    fs::create_directories(directory);
+    const std::string stale = directory + "/abandoned.json.tmp123";
+    const std::string writing = directory + "/writing.json.tmp456";
+    std::ofstream(stale) << std::string(5000, 'x');
+    std::ofstream(writing) << std::string(1500, 'x');
+    fs::last_write_time(stale, fs::file_time_type::clock::now() - std::chrono::minutes(2));
+
+    std::string payload(1000, 'x');
+    std::string body;
+    cache.store("feed", "2020-01-01", "2020-01-01", payload);
+    EXPECT_FALSE(fs::exists(stale));
+    EXPECT_TRUE(fs::exists(writing));
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        if (entry.path().extension() == ".json") {
+            fs::last_write_time(entry.path(), fs::file_time_type::clock::now() - std::chrono::hours(1));
+        }
+    }
+    cache.store("feed", "2020-01-02", "2020-01-02", payload);
+
+    // 1500 bytes in flight plus two entries exceed the limit, so the older entry goes
+    EXPECT_TRUE(fs::exists(writing));
+    EXPECT_FALSE(cache.lookup("feed", "2020-01-01", "2020-01-01", body));
+    EXPECT_TRUE(cache.lookup("feed", "2020-01-02", "2020-01-02", body));
+    EXPECT_LE(cache.sizeOnDisk(), cacheOptions.maxBytes);
+}
+
+// A second range fetch is answered from the cache without any request
+TEST_F(ResponseCacheTest, RangeFetchUsesCache) {
+    LocalHttpServer server([](const std::string&) {
+        return std::string("{\"element_count\": 1, \"near_earth_objects\": {\"2020-01-01\": [{\"id\": \"1\"}]}}");
+    });
+    ResponseCache cache(options());
+    RangeFetchOptions fetchOptions;
+    fetchOptions.baseUrl = server.url();
+    fetchOptions.cache = &cache;
+
+    nlohmann::json feed;
+    ASSERT_TRUE(fetch_neo_range(feed, "2020-01-01", "2020-01-14", "TEST_KEY", fetchOptions));
+    EXPECT_EQ(server.requestCount(), 2);
+    ASSERT_TRUE(fetch_neo_range(feed, "2020-01-01", "2020-01-14", "TEST_KEY", fetchOptions));
+    EXPECT_EQ(server.requestCount(), 2);
+    EXPECT_EQ(feed["element_count"].get<int>(), 2);
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+// tests/test_small_vector.cpp
+
+#include <gtest/gtest.h>
+#include "src/neo_fields.h"
+#include "src/small_vector.h"
+
+TEST(SmallVectorTest, StaysInlineUpToCapacity) {
+    SmallVector<int, 2> values;
+    EXPECT_TRUE(values.isInline());
+    values.push_back(1);
+    values.push_back(2);
+    EXPECT_TRUE(values.isInline());
+    EXPECT_EQ(values.heapBytes(), 0u);
+
+    values.push_back(3);
+    EXPECT_FALSE(values.isInline());
+    EXPECT_EQ(values.capacity(), 4u);
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values.back(), 3);
+
+    // An element of the vector itself survives the regrowth it triggers
+    values.push_back(values[3 - 1]);
+    values.push_back(values[0]);
+    EXPECT_EQ(values[3], 3);
+    EXPECT_EQ(values[4], 1);
+}
+
+TEST(SmallVectorTest, CopiesAndMoves) {
+    SmallVector<int, 1> single{7};
+    SmallVector<int, 1> many{1, 2, 3};
+
+    SmallVector<int, 1> copy(many);
+    EXPECT_TRUE(copy == many);
+    const int* heap = many.data();
+    SmallVector<int, 1> moved(std::move(many));
+    EXPECT_EQ(moved.data(), heap); // Heap storage changes hands
+    EXPECT_TRUE(many.empty());
+    EXPECT_TRUE(many.isInline());
+
+    SmallVector<int, 1> target{4, 5};
+    target = std::move(single);
+    EXPECT_TRUE(target.isInline());
+    ASSERT_EQ(target.size(), 1u);
+    EXPECT_EQ(target[0], 7);
+
+    target = copy;
+    EXPECT_TRUE(target == copy);
+    target.resize(5);
+    EXPECT_EQ(target[4], 0);
+    target.clear();
+    EXPECT_TRUE(target.empty());
+}
+
+// Heap storage comes from the given resource; moves between resources copy
+TEST(SmallVectorTest, UsesMemoryResource) {
+    alignas(16) unsigned char buffer[256];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    auto inBuffer = [&](const void* pointer) {
+        return pointer >= static_cast<void*>(buffer) && pointer < static_cast<void*>(buffer + sizeof(buffer));
+    };
+
+    SmallVector<int, 1> values(&arena);
+    values.push_back(1);
+    values.push_back(2);
+    values.push_back(3);
+    EXPECT_TRUE(inBuffer(values.data()));
+    EXPECT_EQ(values.resource(), &arena);
+
+    SmallVector<int, 1> copy(values); // Copies use the default resource
+    EXPECT_EQ(copy.resource(), std::pmr::get_default_resource());
+    EXPECT_FALSE(inBuffer(copy.data()));
+
+    SmallVector<int, 1> moved(std::move(values));
+    EXPECT_EQ(moved.resource(), &arena);
+    EXPECT_TRUE(inBuffer(moved.data()));
+
+    copy = std::move(moved); // Different resources: copied, the target keeps its own
+    EXPECT_FALSE(inBuffer(copy.data()));
+    EXPECT_TRUE(moved.empty());
+    ASSERT_EQ(copy.size(), 3u);
+    EXPECT_EQ(copy[2], 3);
+}
+
+// A close approach with its date fits inline, with no string to allocate
+TEST(SmallVectorTest, CloseApproachListIsCompact) {
+    static_assert(sizeof(NeoDate) == 4, "NeoDate is a day number");
+    static_assert(std::is_trivially_copyable<CloseApproachData>::value, "CloseApproachData has no heap parts");
+
+    CloseApproachList approaches;
+    approaches.push_back({"2024-10-10", 12.5, 3.0e6});
+    EXPECT_TRUE(approaches.isInline());
+    EXPECT_EQ(approaches[0].date, "2024-10-10");
+    EXPECT_EQ(approaches[0].date.str(), "2024-10-10");
+    EXPECT_TRUE(NeoDate("2024-09-30") < NeoDate("2024-10-01"));
+    EXPECT_EQ(NeoDate("1970-01-02").days(), 1);
+
+    NeoDate date;
+    EXPECT_FALSE(NeoDate::parse("2024-Oct-10", date));
+    EXPECT_FALSE(NeoDate::parse("2024-13-01", date));
+    EXPECT_FALSE(NeoDate::parse("2024-10-10 ", date));
+    EXPECT_THROW(NeoDate("10/10/2024"), std::invalid_argument);
+}
+
+// Days are checked against the length of their month, leap years included
+TEST(SmallVectorTest, DatesStayInsideTheirMonth) {
+    int64_t days = 0;
+    EXPECT_TRUE(NeoDates::parseDate("2024-02-29", days));
+    EXPECT_EQ(NeoDates::formatDate(days), "2024-02-29");
+    EXPECT_TRUE(NeoDates::parseDate("2000-02-29", days));
+    EXPECT_TRUE(NeoDates::parseDate("2023-04-30", days));
+    EXPECT_TRUE(NeoDates::parseDate("2023-12-31", days));
+    EXPECT_FALSE(NeoDates::parseDate("2023-02-29", days));
+    EXPECT_FALSE(NeoDates::parseDate("1900-02-29", days));
+    EXPECT_FALSE(NeoDates::parseDate("2024-02-30", days));
+    EXPECT_FALSE(NeoDates::parseDate("2024-02-31", days));
+    EXPECT_FALSE(NeoDates::parseDate("2023-04-31", days));
+    EXPECT_THROW(NeoDate("2023-04-31"), std::invalid_argument);
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
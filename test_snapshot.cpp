@@ -0,0 +1,198 @@
+// tests/test_snapshot.cpp
+
+#include <gtest/gtest.h>
+#include "src/classes.h"
+#include "src/get_data.h"
+#include "src/neo_snapshot.h"
+#include "json.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using json = nlohmann::json;
+
+class SnapshotTest : public ::testing::Test {
+protected:
+    const std::string snapshotPath = "test_data.snapshot";
+
+    void SetUp() override {
+        ASSERT_TRUE(write_snapshot("data.json", snapshotPath));
+        ASSERT_TRUE(load_from_file(feed, "data.json"));
+    }
+
+    void TearDown() override {
+        std::remove(snapshotPath.c_str());
+    }
+
+    json feed;
+};
+
+// Every column holds the values of the source feed
+TEST_F(SnapshotTest, ColumnsMatchFeed) {
+    NeoSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(snapshotPath));
+    ASSERT_EQ(snapshot.size(), feed["element_count"].get<size_t>());
+
+    size_t checked = 0;
+    for (size_t i = 0; i < snapshot.size(); i++) {
+        std::string date(snapshot.feedDate(i));
+        ASSERT_TRUE(feed["near_earth_objects"].contains(date));
+        for (const auto& neo : feed["near_earth_objects"][date]) {
+            if (std::to_string(snapshot.id(i)) != neo["id"].get<std::string>()) continue;
+
+            EXPECT_EQ(snapshot.name(i), neo["name"].get<std::string>());
+            EXPECT_EQ(snapshot.nasaJplUrl(i), neo["nasa_jpl_url"].get<std::string>());
+            EXPECT_EQ(snapshot.minDiameterKm(i), neo["estimated_diameter"]["kilometers"]["estimated_diameter_min"].get<double>());
+            EXPECT_EQ(snapshot.maxDiameterKm(i), neo["estimated_diameter"]["kilometers"]["estimated_diameter_max"].get<double>());
+            EXPECT_EQ(snapshot.absoluteMagnitude(i), neo["absolute_magnitude_h"].get<double>());
+            EXPECT_EQ(snapshot.isHazardous(i), neo["is_potentially_hazardous_asteroid"].get<bool>());
+
+            const auto& approaches = neo["close_approach_data"];
+            ASSERT_EQ(snapshot.approachEnd(i) - snapshot.approachBegin(i), approaches.size());
+            uint32_t a = snapshot.approachBegin(i);
+            EXPECT_EQ(snapshot.velocityKmPerS(a), std::stod(approaches[0]["relative_velocity"]["kilometers_per_second"].get<std::string>()));
+            EXPECT_EQ(snapshot.missDistanceKm(a), std::stod(approaches[0]["miss_distance"]["kilometers"].get<std::string>()));
+            EXPECT_EQ(snapshot.epochMs(a), approaches[0]["epoch_date_close_approach"].get<int64_t>());
+            checked++;
+        }
+    }
+    EXPECT_EQ(checked, snapshot.size());
+}
+
+// Asteroids rebuilt from a snapshot equal the ones built from the JSON feed
+TEST_F(SnapshotTest, FeedForDateBuildsSameAsteroids) {
+    NeoSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(snapshotPath));
+
+    const std::string date = "2024-09-30";
+    json rebuilt = snapshot.feedForDate(date);
+    const auto& expected = feed["near_earth_objects"][date];
+    ASSERT_EQ(rebuilt["near_earth_objects"][date].size(), expected.size());
+
+    for (size_t i = 0; i < expected.size(); i++) {
+        Asteroid original(expected[i]);
+        Asteroid restored(rebuilt["near_earth_objects"][date][i]);
+        EXPECT_EQ(restored.getID(), original.getID());
+        EXPECT_EQ(restored.getName(), original.getName());
+        EXPECT_EQ(restored.getNasaJplUrl(), original.getNasaJplUrl());
+        EXPECT_EQ(restored.getMass(), original.getMass());
+        EXPECT_EQ(restored.getRelativeVelocityKmPerS(), original.getRelativeVelocityKmPerS());
+        EXPECT_EQ(restored.getMissDistanceKm(), original.getMissDistanceKm());
+        EXPECT_EQ(restored.getCloseApproachData()[0].date, original.getCloseApproachData()[0].date);
+    }
+
+    EXPECT_TRUE(snapshot.feedForDate("1999-01-01")["near_earth_objects"].empty());
+}
+
+// Records are read like extract_neo_fields reads them: malformed ids and
+// numbers are skipped, and epochs come from close_approach_date_full when
+// epoch_date_close_approach is missing
+TEST_F(SnapshotTest, ReadsRecordsLikeNeoFields) {
+    auto record = [](const std::string& id, const std::string& velocity) {
+        return json{{"id", id},
+                    {"name", "NEO " + id},
+                    {"nasa_jpl_url", "https://ssd.jpl.nasa.gov/?sstr=" + id},
+                    {"absolute_magnitude_h", 20.5},
+                    {"estimated_diameter", {{"kilometers", {{"estimated_diameter_min", 0.1}, {"estimated_diameter_max", 0.2}}}}},
+                    {"is_potentially_hazardous_asteroid", false},
+                    {"close_approach_data", json::array({{{"close_approach_date", "2024-09-30"},
+                                                          {"close_approach_date_full", "2024-Sep-30 02:06"},
+                                                          {"relative_velocity", {{"kilometers_per_second", velocity}}},
+                                                          {"miss_distance", {{"kilometers", "384400.5"}}}}})}};
+    };
+    json records = json::array({record("2154229", "12.5"), record("12abc", "12.5"), record("-1", "12.5"),
+                                record("3000001", "12.5km")});
+    json source = {{"element_count", records.size()}, {"near_earth_objects", {{"2024-09-30", records}}}};
+    const std::string sourcePath = "test_records.json";
+    std::ofstream(sourcePath) << source.dump();
+
+    testing::internal::CaptureStderr();
+    ASSERT_TRUE(write_snapshot(sourcePath, snapshotPath));
+    std::string log = testing::internal::GetCapturedStderr();
+    std::remove(sourcePath.c_str());
+
+    NeoSnapshot snapshot;
+    ASSERT_TRUE(snapshot.open(snapshotPath));
+    ASSERT_EQ(snapshot.size(), 1u) << log;
+    EXPECT_EQ(snapshot.id(0), 2154229u);
+    EXPECT_EQ(snapshot.velocityKmPerS(0), 12.5);
+    EXPECT_EQ(snapshot.missDistanceKm(0), 384400.5);
+    EXPECT_EQ(snapshot.epochMs(0), 1727661960000); // 2024-09-30 02:06 UTC, not midnight
+
+    json rebuilt = snapshot.feedForDate("2024-09-30")["near_earth_objects"]["2024-09-30"][0]["close_approach_data"][0];
+    EXPECT_FALSE(rebuilt.contains("orbiting_body"));
+}
+
+// Files that are not snapshots, or are cut short, are rejected
+TEST_F(SnapshotTest, RejectsInvalidFiles) {
+    NeoSnapshot snapshot;
+    EXPECT_FALSE(snapshot.open("data.json"));
+    EXPECT_FALSE(snapshot.open("does_not_exist.snapshot"));
+
+    std::ifstream in(snapshotPath, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    const std::string truncatedPath = "test_truncated.snapshot";
+    std::ofstream out(truncatedPath, std::ios::binary);
+    out.write(bytes.data(), bytes.size() / 2);
+    out.close();
+    EXPECT_FALSE(snapshot.open(truncatedPath));
+    std::remove(truncatedPath.c_str());
+}
+
+// Files whose counts, offsets or string references point outside their
+// columns are rejected before anything reads through them
+TEST_F(SnapshotTest, RejectsCorruptFiles) {
+    std::ifstream in(snapshotPath, std::ios::binary);
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    SnapshotHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    ASSERT_GT(header.asteroidCount, 1u);
+
+    const std::string corruptPath = "test_corrupt.snapshot";
+    auto openPatched = [&](size_t position, const void* value, size_t size) {
+        std::string patched = bytes;
+        std::memcpy(&patched[position], value, size);
+        std::ofstream out(corruptPath, std::ios::binary);
+        out.write(patched.data(), patched.size());
+        out.close();
+        NeoSnapshot snapshot;
+        testing::internal::CaptureStderr();
+        bool opened = snapshot.open(corruptPath);
+        testing::internal::GetCapturedStderr();
+        return opened;
+    };
+
+    // A count whose byte sizes wrap around to something small
+    uint64_t hugeCount = (uint64_t(1) << 61) + 1;
+    EXPECT_FALSE(openPatched(offsetof(SnapshotHeader, asteroidCount), &hugeCount, sizeof(hugeCount)));
+    EXPECT_FALSE(openPatched(offsetof(SnapshotHeader, approachCount), &hugeCount, sizeof(hugeCount)));
+
+    // Approach offsets that go backwards, or past the approach columns
+    size_t offsets = header.columnOffsets[NeoSnapshotFormat::ApproachBegin];
+    uint32_t beyond = static_cast<uint32_t>(header.approachCount + 1);
+    EXPECT_FALSE(openPatched(offsets + sizeof(uint32_t), &beyond, sizeof(beyond)));
+    uint32_t last = static_cast<uint32_t>(header.approachCount - 1);
+    EXPECT_FALSE(openPatched(offsets + header.asteroidCount * sizeof(uint32_t), &last, sizeof(last)));
+
+    // Names, URLs and feed dates that run past the string heap
+    StringRef outside{static_cast<uint32_t>(header.stringHeapSize - 2), 3};
+    EXPECT_FALSE(openPatched(header.columnOffsets[NeoSnapshotFormat::NameRefs], &outside, sizeof(outside)));
+    EXPECT_FALSE(openPatched(header.columnOffsets[NeoSnapshotFormat::UrlRefs] + sizeof(StringRef), &outside,
+                             sizeof(outside)));
+    StringRef wrapping{UINT32_MAX, 2};
+    EXPECT_FALSE(openPatched(header.columnOffsets[NeoSnapshotFormat::FeedDates], &wrapping, sizeof(wrapping)));
+
+    // The unpatched bytes still open
+    uint32_t zero = 0;
+    EXPECT_TRUE(openPatched(offsets, &zero, sizeof(zero)));
+    std::remove(corruptPath.c_str());
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+// tests/test_stream_fetch.cpp
+
+#include <gtest/gtest.h>
+#include "src/stream_fetch.h"
+#include "local_http_server.h"
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+static std::string readDataFile() {
+    std::ifstream file("data.json");
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// A download yields the same NEOs under the same dates as the local file
+TEST(StreamFetchTest, MatchesFileLoader) {
+    std::string feed = readDataFile();
+    ASSERT_FALSE(feed.empty()) << "Failed to open data.json";
+    LocalHttpServer server([&feed](const std::string&) { return feed; });
+
+    std::map<std::string, std::vector<std::string>> expectedIds;
+    ASSERT_TRUE(stream_from_file("data.json", [&](const std::string& date, const Asteroid& asteroid) {
+        expectedIds[date].emplace_back(asteroid.getID());
+    }));
+
+    FetchSession session;
+    StreamFetchStats stats;
+    std::map<std::string, std::vector<std::string>> streamedIds;
+    ASSERT_TRUE(stream_neo_url(session, server.url(), [&](const std::string& date, const Asteroid& asteroid) {
+        streamedIds[date].emplace_back(asteroid.getID());
+    }, &stats));
+
+    EXPECT_EQ(streamedIds, expectedIds);
+    EXPECT_EQ(stats.bytes, feed.size());
+    EXPECT_EQ(stats.records, 144u); // element_count of data.json
+}
+
+// On a slow link records come out long before the body has finished arriving
+TEST(StreamFetchTest, FirstRecordArrivesDuringDownload) {
+    std::string feed = readDataFile();
+    ASSERT_FALSE(feed.empty()) << "Failed to open data.json";
+    LocalHttpServer server([&feed](const std::string&) { return feed; });
+    server.throttle(16 * 1024, 10); // About 21 chunks, 200 ms in total
+
+    FetchSession session;
+    StreamFetchStats stats;
+    double lastRecordSeconds = 0;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(stream_neo_url(session, server.url(), [&](const std::string&, const Asteroid&) {
+        lastRecordSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }, &stats));
+
+    EXPECT_GT(stats.firstRecordSeconds, 0);
+    EXPECT_LT(stats.firstRecordSeconds, stats.totalSeconds / 2);
+    EXPECT_LE(lastRecordSeconds, stats.totalSeconds);
+    EXPECT_GE(stats.totalSeconds, 0.15);
+}
+
+// A tiny pipe makes the transfer wait for the parser without losing bytes
+TEST(StreamFetchTest, BackPressureKeepsEveryRecord) {
+    std::string feed = readDataFile();
+    ASSERT_FALSE(feed.empty()) << "Failed to open data.json";
+    LocalHttpServer server([&feed](const std::string&) { return feed; });
+
+    FetchSession session;
+    StreamFetchStats stats;
+    ASSERT_TRUE(stream_neo_url(session, server.url(), [](const std::string&, const Asteroid&) {}, &stats, 1));
+    EXPECT_EQ(stats.records, 144u); // element_count of data.json
+}
+
+TEST(StreamFetchTest, InvalidBodyFails) {
+    LocalHttpServer server([](const std::string&) { return std::string("{\"near_earth_objects\": {\"2024-"); });
+    FetchSession session;
+    StreamFetchStats stats;
+    EXPECT_FALSE(stream_neo_url(session, server.url(), [](const std::string&, const Asteroid&) {}, &stats));
+    EXPECT_EQ(stats.records, 0u);
+}
+
+// Errors name the date range and endpoint, never the API key in the query
+TEST(StreamFetchTest, ErrorsKeepKeyOutOfLog) {
+    LocalHttpServer server([](const std::string&) { return std::string("not json"); });
+    FetchSession session;
+    std::string url = server.url() + "?start_date=2024-01-01&end_date=2024-01-07&api_key=SECRET_KEY";
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(stream_neo_url(session, url, [](const std::string&, const Asteroid&) {}));
+    std::string log = testing::internal::GetCapturedStderr();
+    EXPECT_NE(log.find("Invalid feed returned for 2024-01-01 to 2024-01-07 from " + server.url()), std::string::npos)
+        << log;
+    EXPECT_EQ(log.find("SECRET_KEY"), std::string::npos) << log;
+}
+
+TEST(StreamFetchTest, ReportsTransportErrors) {
+    int port;
+    {
+        LocalHttpServer server([](const std::string&) { return std::string(); });
+        port = server.port();
+    }
+    FetchSession session;
+    StreamFetchStats stats;
+    EXPECT_FALSE(stream_neo_url(session, "http://127.0.0.1:" + std::to_string(port) + "/feed",
+                                [](const std::string&, const Asteroid&) {}, &stats));
+    EXPECT_LT(stats.firstRecordSeconds, 0);
+}
+
+// An exception from the handler stops the download and reaches the caller
+TEST(StreamFetchTest, HandlerExceptionStopsTransfer) {
+    std::string feed = readDataFile();
+    ASSERT_FALSE(feed.empty()) << "Failed to open data.json";
+    LocalHttpServer server([&feed](const std::string&) { return feed; });
+    server.throttle(4 * 1024, 5);
+
+    FetchSession session;
+    EXPECT_THROW(stream_neo_url(session, server.url(), [](const std::string&, const Asteroid&) {
+        throw std::runtime_error("stop");
+    }), std::runtime_error);
+
+    // The session is usable again afterwards
+    std::string body;
+    EXPECT_TRUE(session.get(server.url(), body));
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,104 @@
+// tests/test_stream_loader.cpp
+
+#include <gtest/gtest.h>
+#include "src/classes.h"
+#include "src/neo_stream.h"
+#include "json.hpp"
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+using json = nlohmann::json;
+
+// The streaming loader must see the same NEOs under the same dates as the DOM path
+TEST(StreamLoaderTest, MatchesDomLoaderOnDataFile) {
+    std::ifstream file("data.json");
+    ASSERT_TRUE(file.is_open()) << "Failed to open data.json";
+    json feed;
+    file >> feed;
+
+    std::map<std::string, std::vector<std::string>> expectedIds;
+    for (const auto& entry : feed["near_earth_objects"].items()) {
+        for (const auto& neo : entry.value()) {
+            expectedIds[entry.key()].push_back(neo["id"].get<std::string>());
+        }
+    }
+
+    std::map<std::string, std::vector<std::string>> streamedIds;
+    size_t count = 0;
+    ASSERT_TRUE(stream_from_file("data.json", [&](const std::string& date, const Asteroid& asteroid) {
+        streamedIds[date].emplace_back(asteroid.getID());
+        count++;
+    }));
+
+    EXPECT_EQ(streamedIds, expectedIds);
+    EXPECT_EQ(count, feed["element_count"].get<size_t>());
+}
+
+// Records are built with the same values the DOM-based constructor produces
+TEST(StreamLoaderTest, RecordValuesMatchAsteroidConstructor) {
+    std::string feedText = R"({
+        "element_count": 1,
+        "near_earth_objects": {
+            "2024-10-10": [{
+                "id": "12345",
+                "name": "StreamedAsteroid",
+                "nasa_jpl_url": "https://ssd.jpl.nasa.gov/tools/sbdb_lookup.html#/?sstr=12345",
+                "absolute_magnitude_h": 21.5,
+                "estimated_diameter": {"kilometers": {"estimated_diameter_min": 0.2, "estimated_diameter_max": 0.4}},
+                "is_potentially_hazardous_asteroid": true,
+                "close_approach_data": [{
+                    "close_approach_date": "2024-10-10",
+                    "relative_velocity": {"kilometers_per_second": "12.5"},
+                    "miss_distance": {"kilometers": "3000000"},
+                    "orbiting_body": "Earth"
+                }]
+            }]
+        }
+    })";
+    Asteroid expected(json::parse(feedText)["near_earth_objects"]["2024-10-10"][0]);
+
+    std::istringstream input(feedText);
+    int count = 0;
+    ASSERT_TRUE(stream_neo_data(input, [&](const std::string& date, const Asteroid& asteroid) {
+        count++;
+        EXPECT_EQ(date, "2024-10-10");
+        EXPECT_EQ(asteroid.getName(), expected.getName());
+        EXPECT_DOUBLE_EQ(asteroid.getMass(), expected.getMass());
+        EXPECT_DOUBLE_EQ(asteroid.getAbsoluteMagnitude(), expected.getAbsoluteMagnitude());
+        EXPECT_DOUBLE_EQ(asteroid.getRelativeVelocityKmPerS(), expected.getRelativeVelocityKmPerS());
+        EXPECT_DOUBLE_EQ(asteroid.getMissDistanceKm(), expected.getMissDistanceKm());
+        EXPECT_TRUE(asteroid.isDangerous());
+    }));
+    EXPECT_EQ(count, 1);
+}
+
+// A malformed record is skipped without stopping the rest of the feed
+TEST(StreamLoaderTest, SkipsIncompleteRecords) {
+    std::istringstream input(R"({"near_earth_objects": {"2024-10-10": [
+        {"id": "1", "name": "Broken"},
+        {"id": "2", "name": "Fine", "nasa_jpl_url": "u", "absolute_magnitude_h": 20.0,
+         "estimated_diameter": {"kilometers": {"estimated_diameter_min": 0.1, "estimated_diameter_max": 0.2}},
+         "is_potentially_hazardous_asteroid": false,
+         "close_approach_data": []}
+    ]}})");
+    std::vector<std::string> ids;
+    EXPECT_TRUE(stream_neo_data(input, [&](const std::string&, const Asteroid& asteroid) {
+        ids.emplace_back(asteroid.getID());
+    }));
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(ids[0], "2");
+}
+
+// Truncated input is reported as a failure
+TEST(StreamLoaderTest, TruncatedInputFails) {
+    std::istringstream input(R"({"near_earth_objects": {"2024-10-10": [{"id": "1")");
+    EXPECT_FALSE(stream_neo_data(input, [](const std::string&, const Asteroid&) {}));
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
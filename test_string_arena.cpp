@@ -0,0 +1,33 @@
+// tests/test_string_arena.cpp
+
+#include <gtest/gtest.h>
+#include "src/string_arena.h"
+
+TEST(StringArenaTest, StoresStringsBackToBack) {
+    StringArena arena;
+    ArenaRef first = arena.add("154229 (2002 JN97)");
+    ArenaRef second = arena.add("(2024 AB)");
+    EXPECT_EQ(arena.view(first), "154229 (2002 JN97)");
+    EXPECT_EQ(arena.view(second), "(2024 AB)");
+    EXPECT_EQ(second.offset, first.offset + first.length);
+    EXPECT_EQ(arena.size(), 27u);
+}
+
+TEST(StringArenaTest, EmptyStringsTakeNoSpace) {
+    StringArena arena;
+    ArenaRef empty = arena.add("");
+    EXPECT_EQ(empty.length, 0u);
+    EXPECT_EQ(arena.view(empty), "");
+    EXPECT_EQ(arena.size(), 0u);
+
+    arena.add("text");
+    arena.clear();
+    EXPECT_EQ(arena.size(), 0u);
+    EXPECT_EQ(arena.view(arena.add("again")), "again");
+}
+
+// Main function for running tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}